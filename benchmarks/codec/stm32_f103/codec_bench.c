@@ -0,0 +1,212 @@
+/*
+ * Description:
+ *  Test benchmark for hex and Base64 codecs:
+ *  snprintf/hexenc32, hexdec32, b64enc32, b64dec32
+ *
+ * ATTENTION!
+ * Result values in clocks may differ up to +/-6 clocks !
+ *
+ * Author: 
+ *  Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string32.h>
+
+//--------------------------------------------//
+typedef struct {
+  uint32_t DWT_LAR;        // Lock Access Register  | 0xE0000FB0
+  uint32_t DWT_LSR;        // Lock Status Register  | 0xE0000FB4
+
+  uint32_t DWT_UNKNOWN[18];
+
+  uint32_t DWT_CTRL;       // Control Register      | 0xE0001000
+  uint32_t DWT_CYCCNT;     // Cycle Count Register  | 0xE0001004
+  uint32_t DWT_CPICNT;     // CPI Count Register
+  uint32_t DWT_EXCCNT;     // Exception Overhead Count Register
+  uint32_t DWT_SLEEPCNT;   // Sleep Count Register
+  uint32_t DWT_LSUCNT;     // LSU Count Register
+  uint32_t DWT_FOLDCNT;    // Folded-instruction Count Register
+  uint32_t DWT_PCSR;       // Program Counter Sample Register
+  uint32_t DWT_COMP0;      // Comparator Register 0
+  uint32_t DWT_MASK0;      // Mask Register 0
+  uint32_t DWT_FUNCTION0;  // Function Register 0
+  uint32_t DWT_COMP1;      // Comparator Register 1
+  uint32_t DWT_MASK1;      // Mask Register 1
+  uint32_t DWT_FUNCTION1;  // Function Register 1
+  uint32_t DWT_COMP2;      // Comparator Register 2
+  uint32_t DWT_MASK2;      // Mask Register 2
+  uint32_t DWT_FUNCTION2;  // Function Register 2
+  uint32_t DWT_COMP3;      // Comparator Register 3
+  uint32_t DWT_MASK3;      // Mask Register 3
+  uint32_t DWT_FUNCTION3;  // Function Register 3
+  // Some of the registers is not added here
+  // From 0xE0001FD0 -> 0xE0001FFC
+} DWT_TypeDef;  // 0xE0000FB0 -> 0xE0000FB4
+
+/*
+ * ITM registers to perform clocks count
+ * For STM32 this registers are the same (mostly ?).
+ */
+#define SCB_DEMCR   *(volatile uint32_t* )0xE000EDFC // CoreDebug
+#define DWT         ((DWT_TypeDef*) ((volatile uint32_t) 0xE0000FB0))
+
+const uint32_t DWT_LAR_MAGIC = 0xC5ACCE55;
+//--------------------------------------------//
+
+__attribute__ ((optimize("O0")))
+uint32_t ul_benchmark_std(char* pc_dst, const void* pv_src, size_t x_size)
+{
+  volatile uint32_t ul_res = 0UL;
+  uint32_t ul_res_total = 0UL;
+  const uint8_t* puc_src = (const uint8_t*) pv_src;
+
+  // Usual way to hex-dump a blob
+  DWT->DWT_CYCCNT = 0UL;
+  for (size_t x_i = 0; x_i < x_size; x_i++) {
+    snprintf(&pc_dst[x_i * 2], 3, "%02x", puc_src[x_i]);
+  }
+
+  ul_res = DWT->DWT_CYCCNT;
+  ul_res_total += ul_res;
+  DWT->DWT_CYCCNT = 0UL;
+
+  return ul_res_total;
+}
+
+__attribute__ ((optimize("O0")))
+uint32_t ul_benchmark_32(char* pc_dst, const void* pv_src, size_t x_size)
+{
+  volatile uint32_t ul_res = 0UL;
+  uint32_t ul_res_total = 0UL;
+
+  DWT->DWT_CYCCNT = 0UL;
+  hexenc32(pc_dst, pv_src, x_size);
+
+  ul_res = DWT->DWT_CYCCNT;
+  ul_res_total += ul_res;
+  DWT->DWT_CYCCNT = 0UL;
+
+  return ul_res_total;
+}
+
+__attribute__ ((optimize("O0")))
+uint32_t ul_benchmark_hexdec32(void* pv_dst, const char* pc_src, size_t x_size)
+{
+  volatile uint32_t ul_res = 0UL;
+  uint32_t ul_res_total = 0UL;
+
+  DWT->DWT_CYCCNT = 0UL;
+  hexdec32(pv_dst, pc_src, x_size);
+
+  ul_res = DWT->DWT_CYCCNT;
+  ul_res_total += ul_res;
+  DWT->DWT_CYCCNT = 0UL;
+
+  return ul_res_total;
+}
+
+__attribute__ ((optimize("O0")))
+uint32_t ul_benchmark_b64enc32(char* pc_dst, const void* pv_src, size_t x_size)
+{
+  volatile uint32_t ul_res = 0UL;
+  uint32_t ul_res_total = 0UL;
+
+  DWT->DWT_CYCCNT = 0UL;
+  b64enc32(pc_dst, pv_src, x_size);
+
+  ul_res = DWT->DWT_CYCCNT;
+  ul_res_total += ul_res;
+  DWT->DWT_CYCCNT = 0UL;
+
+  return ul_res_total;
+}
+
+__attribute__ ((optimize("O0")))
+uint32_t ul_benchmark_b64dec32(void* pv_dst, const char* pc_src, size_t x_size)
+{
+  volatile uint32_t ul_res = 0UL;
+  uint32_t ul_res_total = 0UL;
+
+  DWT->DWT_CYCCNT = 0UL;
+  b64dec32(pv_dst, pc_src, x_size);
+
+  ul_res = DWT->DWT_CYCCNT;
+  ul_res_total += ul_res;
+  DWT->DWT_CYCCNT = 0UL;
+
+  return ul_res_total;
+}
+
+//--------------------------------------------//
+const uint8_t uc_buff_test_128b[128] = "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Duis dictum, risus id congue malesuada, nibh urna feugiat velit ligula.";
+const uint8_t uc_buff_test_16b[16] = "Lorem ipsum leo.";
+
+char c_buff_text[STRING32_HEXENC_LEN(128) + 1];
+uint8_t uc_buff_data[128];
+
+/*
+ * @brief Enables debug counter to mesure wasted clocks
+ * @retval none
+ */
+void init_dwt(void)
+{
+  DWT->DWT_LAR = DWT_LAR_MAGIC;  // unlock access to DWT (ITM, etc.)registers
+  SCB_DEMCR |= 0x01000000;       // enable trace
+
+  DWT->DWT_CTRL |= 1;         // enable the counter
+  DWT->DWT_CYCCNT = 0;        // reset the counter
+}
+
+int main(void)
+{
+  __disable_irq(); // __ASM volatile ("cpsid i");
+
+  init_dwt();
+
+  uint32_t ul_total_clocks = 0UL;
+
+  // snprintf("%02x") hex dump:
+  ul_total_clocks += ul_benchmark_std(&c_buff_text[0], &uc_buff_test_128b[0], sizeof(uc_buff_test_128b));
+  ul_total_clocks += ul_benchmark_std(&c_buff_text[0], &uc_buff_test_16b[0], sizeof(uc_buff_test_16b));
+
+  // hexenc32:
+  ul_total_clocks = 0UL;
+  ul_total_clocks += ul_benchmark_32(&c_buff_text[0], &uc_buff_test_128b[0], sizeof(uc_buff_test_128b));
+  ul_total_clocks += ul_benchmark_32(&c_buff_text[0], &uc_buff_test_16b[0], sizeof(uc_buff_test_16b));
+
+  // hexdec32:
+  ul_total_clocks = 0UL;
+  hexenc32(&c_buff_text[0], &uc_buff_test_128b[0], sizeof(uc_buff_test_128b));
+  ul_total_clocks += ul_benchmark_hexdec32(&uc_buff_data[0], &c_buff_text[0], STRING32_HEXENC_LEN(128));
+  ul_total_clocks += ul_benchmark_hexdec32(&uc_buff_data[0], &c_buff_text[0], STRING32_HEXENC_LEN(16));
+
+  // b64enc32:
+  ul_total_clocks = 0UL;
+  ul_total_clocks += ul_benchmark_b64enc32(&c_buff_text[0], &uc_buff_test_128b[0], sizeof(uc_buff_test_128b));
+  ul_total_clocks += ul_benchmark_b64enc32(&c_buff_text[0], &uc_buff_test_16b[0], sizeof(uc_buff_test_16b));
+
+  // b64dec32:
+  ul_total_clocks = 0UL;
+  b64enc32(&c_buff_text[0], &uc_buff_test_128b[0], sizeof(uc_buff_test_128b));
+  ul_total_clocks += ul_benchmark_b64dec32(&uc_buff_data[0], &c_buff_text[0], STRING32_B64ENC_LEN(128));
+  ul_total_clocks += ul_benchmark_b64dec32(&uc_buff_data[0], &c_buff_text[0], STRING32_B64ENC_LEN(15));
+
+  for (;;) {
+    __WFI();
+  }
+
+  return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * Description:
+ *  Benchmark of memhash32/strhash32 against FNV-1a on Linux host.
+ *  Clocks are nanoseconds of CLOCK_MONOTONIC per call.
+ *
+ * Build:
+ *  cc -O2 -I../../.. hash_bench.c ../../../string32.c -o hash_bench
+ *
+ * Author: 
+ *  Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <string32.h>
+
+#define BENCH_REPEATS  100000UL
+
+//--------------------------------------------//
+typedef enum {
+  BENCH_FNV1A_MEM = 0,
+  BENCH_MEMHASH,
+  BENCH_FNV1A_STR,
+  BENCH_STRHASH,
+
+  BENCH_TOTAL
+} bench_func_t;
+
+static const char* const pc_bench_names[BENCH_TOTAL] = {
+  "fnv1a",
+  "memhash32",
+  "fnv1a_str",
+  "strhash32",
+};
+
+static uint8_t uc_buff_src[4096 + 8] __attribute__ ((aligned(8)));
+static volatile uint32_t ul_bench_sink;
+
+static uint64_t ull_clock_ns(void)
+{
+  struct timespec x_ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &x_ts);
+
+  return (uint64_t) x_ts.tv_sec * 1000000000ULL + (uint64_t) x_ts.tv_nsec;
+}
+
+static uint32_t fnv1a(void const* pv_src, size_t x_len)
+{
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+  uint32_t ul_hash = 0x811C9DC5UL;
+
+  for (size_t x_i = 0UL; x_i < x_len; x_i++) {
+    ul_hash = (ul_hash ^ puc_src[x_i]) * 0x01000193UL;
+  }
+
+  return ul_hash;
+}
+
+static uint32_t fnv1a_str(void const* pv_src)
+{
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+  uint32_t ul_hash = 0x811C9DC5UL;
+
+  while (*puc_src != '\0') {
+    ul_hash = (ul_hash ^ *puc_src++) * 0x01000193UL;
+  }
+
+  return ul_hash;
+}
+
+static double benchmark(bench_func_t e_func, size_t x_offset, size_t x_size)
+{
+  uint8_t const* puc_src = &uc_buff_src[x_offset];
+
+  uc_buff_src[x_offset + x_size] = '\0';
+
+  uint64_t ull_start = ull_clock_ns();
+
+  for (unsigned long ul_i = 0UL; ul_i < BENCH_REPEATS; ul_i++) {
+    switch (e_func) {
+    case BENCH_FNV1A_MEM:
+      ul_bench_sink = fnv1a(puc_src, x_size);
+      break;
+
+    case BENCH_MEMHASH:
+      ul_bench_sink = memhash32(puc_src, x_size);
+      break;
+
+    case BENCH_FNV1A_STR:
+      ul_bench_sink = fnv1a_str(puc_src);
+      break;
+
+    case BENCH_STRHASH:
+      ul_bench_sink = strhash32(puc_src);
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  uint64_t ull_clocks = ull_clock_ns() - ull_start;
+
+  uc_buff_src[x_offset + x_size] = 'a';
+
+  return (double) ull_clocks / (double) BENCH_REPEATS;
+}
+
+int main(void)
+{
+  // Typical hash table keys are short, so most of sizes are small
+  const size_t x_sizes[] = {4, 8, 13, 16, 32, 64, 128, 1024, 4096};
+
+  memset(uc_buff_src, 'a', sizeof(uc_buff_src));
+
+  printf("%-10s %6s %12s %12s\n", "func", "size", "aligned ns", "unaligned ns");
+
+  for (uint32_t ul_func = 0UL; ul_func < BENCH_TOTAL; ul_func++) {
+    for (size_t x_i = 0UL; x_i < (sizeof(x_sizes) / sizeof(x_sizes[0])); x_i++) {
+      printf("%-10s %6zu %12.1f %12.1f\n", pc_bench_names[ul_func], x_sizes[x_i],
+             benchmark((bench_func_t) ul_func, 0UL, x_sizes[x_i]),
+             benchmark((bench_func_t) ul_func, 1UL, x_sizes[x_i]));
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,220 @@
+/*
+ * Description:
+ *  Test benchmark for FNV-1a/memhash32/strhash32
+ *
+ * ATTENTION!
+ * Result values in clocks may differ up to +/-6 clocks !
+ *
+ * Author: 
+ *  Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <string32.h>
+
+//--------------------------------------------//
+typedef struct {
+  uint32_t DWT_LAR;        // Lock Access Register  | 0xE0000FB0
+  uint32_t DWT_LSR;        // Lock Status Register  | 0xE0000FB4
+
+  uint32_t DWT_UNKNOWN[18];
+
+  uint32_t DWT_CTRL;       // Control Register      | 0xE0001000
+  uint32_t DWT_CYCCNT;     // Cycle Count Register  | 0xE0001004
+  uint32_t DWT_CPICNT;     // CPI Count Register
+  uint32_t DWT_EXCCNT;     // Exception Overhead Count Register
+  uint32_t DWT_SLEEPCNT;   // Sleep Count Register
+  uint32_t DWT_LSUCNT;     // LSU Count Register
+  uint32_t DWT_FOLDCNT;    // Folded-instruction Count Register
+  uint32_t DWT_PCSR;       // Program Counter Sample Register
+  uint32_t DWT_COMP0;      // Comparator Register 0
+  uint32_t DWT_MASK0;      // Mask Register 0
+  uint32_t DWT_FUNCTION0;  // Function Register 0
+  uint32_t DWT_COMP1;      // Comparator Register 1
+  uint32_t DWT_MASK1;      // Mask Register 1
+  uint32_t DWT_FUNCTION1;  // Function Register 1
+  uint32_t DWT_COMP2;      // Comparator Register 2
+  uint32_t DWT_MASK2;      // Mask Register 2
+  uint32_t DWT_FUNCTION2;  // Function Register 2
+  uint32_t DWT_COMP3;      // Comparator Register 3
+  uint32_t DWT_MASK3;      // Mask Register 3
+  uint32_t DWT_FUNCTION3;  // Function Register 3
+  // Some of the registers is not added here
+  // From 0xE0001FD0 -> 0xE0001FFC
+} DWT_TypeDef;  // 0xE0000FB0 -> 0xE0000FB4
+
+/*
+ * ITM registers to perform clocks count
+ * For STM32 this registers are the same (mostly ?).
+ */
+#define SCB_DEMCR   *(volatile uint32_t* )0xE000EDFC // CoreDebug
+#define DWT         ((DWT_TypeDef*) ((volatile uint32_t) 0xE0000FB0))
+
+const uint32_t DWT_LAR_MAGIC = 0xC5ACCE55;
+//--------------------------------------------//
+
+static uint32_t fnv1a(void const* pv_src, size_t x_len)
+{
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+  uint32_t ul_hash = 0x811C9DC5UL;  // FNV-1a 32bit offset basis
+
+  for (size_t x_i = 0UL; x_i < x_len; x_i++) {
+    ul_hash = (ul_hash ^ puc_src[x_i]) * 0x01000193UL;
+  }
+
+  return ul_hash;
+}
+
+static uint32_t fnv1a_str(void const* pv_src)
+{
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+  uint32_t ul_hash = 0x811C9DC5UL;
+
+  while (*puc_src != '\0') {
+    ul_hash = (ul_hash ^ *puc_src++) * 0x01000193UL;
+  }
+
+  return ul_hash;
+}
+
+__attribute__ ((optimize("O0")))
+uint32_t ul_benchmark_mem32(const void* pv_data, size_t x_size)
+{
+  volatile uint32_t ul_res = 0UL;
+  uint32_t ul_res_total = 0UL;
+
+  DWT->DWT_CYCCNT = 0UL;
+  uint32_t ul_hash = memhash32(pv_data, x_size);
+
+  ul_res = DWT->DWT_CYCCNT;
+  ul_res_total += ul_res;
+  DWT->DWT_CYCCNT = 0UL;
+
+  return ul_res_total;
+}
+
+__attribute__ ((optimize("O0")))
+uint32_t ul_benchmark_mem_fnv(const void* pv_data, size_t x_size)
+{
+  volatile uint32_t ul_res = 0UL;
+  uint32_t ul_res_total = 0UL;
+
+  DWT->DWT_CYCCNT = 0UL;
+  uint32_t ul_hash = fnv1a(pv_data, x_size);
+
+  ul_res = DWT->DWT_CYCCNT;
+  ul_res_total += ul_res;
+  DWT->DWT_CYCCNT = 0UL;
+
+  return ul_res_total;
+}
+
+__attribute__ ((optimize("O0")))
+uint32_t ul_benchmark_str32(const void* pv_data)
+{
+  volatile uint32_t ul_res = 0UL;
+  uint32_t ul_res_total = 0UL;
+
+  DWT->DWT_CYCCNT = 0UL;
+  uint32_t ul_hash = strhash32(pv_data);
+
+  ul_res = DWT->DWT_CYCCNT;
+  ul_res_total += ul_res;
+  DWT->DWT_CYCCNT = 0UL;
+
+  return ul_res_total;
+}
+
+__attribute__ ((optimize("O0")))
+uint32_t ul_benchmark_str_fnv(const void* pv_data)
+{
+  volatile uint32_t ul_res = 0UL;
+  uint32_t ul_res_total = 0UL;
+
+  DWT->DWT_CYCCNT = 0UL;
+  uint32_t ul_hash = fnv1a_str(pv_data);
+
+  ul_res = DWT->DWT_CYCCNT;
+  ul_res_total += ul_res;
+  DWT->DWT_CYCCNT = 0UL;
+
+  return ul_res_total;
+}
+
+//--------------------------------------------//
+const uint8_t uc_buff_test_128b[129] = "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Duis dictum, risus id congue malesuada, nibh urna feugiat velit ligula.\0";
+const uint8_t uc_buff_test_16b[17] = "Lorem ipsum leo.\0";
+const uint8_t uc_buff_test_15b[16] = "Lorem ipsum ac.\0";
+const uint8_t uc_buff_test_14b[15] = "Lorem aliquam.\0";
+const uint8_t uc_buff_test_13b[14] = "Lorem lectus.\0";
+
+/*
+ * @brief Enables debug counter to mesure wasted clocks
+ * @retval none
+ */
+void init_dwt(void)
+{
+  DWT->DWT_LAR = DWT_LAR_MAGIC;  // unlock access to DWT (ITM, etc.)registers
+  SCB_DEMCR |= 0x01000000;       // enable trace
+
+  DWT->DWT_CTRL |= 1;         // enable the counter
+  DWT->DWT_CYCCNT = 0;        // reset the counter
+}
+
+int main(void)
+{
+  __disable_irq(); // __ASM volatile ("cpsid i");
+
+  init_dwt();
+
+  uint32_t ul_total_clocks = 0UL;
+
+  // FNV-1a:
+  ul_total_clocks += ul_benchmark_mem_fnv(&uc_buff_test_128b[0], sizeof(uc_buff_test_128b)-1);
+  ul_total_clocks += ul_benchmark_mem_fnv(&uc_buff_test_16b[0], sizeof(uc_buff_test_16b)-1);
+  ul_total_clocks += ul_benchmark_mem_fnv(&uc_buff_test_15b[0], sizeof(uc_buff_test_15b)-1);
+  ul_total_clocks += ul_benchmark_mem_fnv(&uc_buff_test_14b[0], sizeof(uc_buff_test_14b)-1);
+  ul_total_clocks += ul_benchmark_mem_fnv(&uc_buff_test_13b[0], sizeof(uc_buff_test_13b)-1);
+
+  // memhash32:
+  ul_total_clocks = 0UL;
+  ul_total_clocks += ul_benchmark_mem32(&uc_buff_test_128b[0], sizeof(uc_buff_test_128b)-1);
+  ul_total_clocks += ul_benchmark_mem32(&uc_buff_test_16b[0], sizeof(uc_buff_test_16b)-1);
+  ul_total_clocks += ul_benchmark_mem32(&uc_buff_test_15b[0], sizeof(uc_buff_test_15b)-1);
+  ul_total_clocks += ul_benchmark_mem32(&uc_buff_test_14b[0], sizeof(uc_buff_test_14b)-1);
+  ul_total_clocks += ul_benchmark_mem32(&uc_buff_test_13b[0], sizeof(uc_buff_test_13b)-1);
+
+
+  // FNV-1a C string:
+  ul_total_clocks = 0UL;
+  ul_total_clocks += ul_benchmark_str_fnv(&uc_buff_test_128b[0]);
+  ul_total_clocks += ul_benchmark_str_fnv(&uc_buff_test_16b[0]);
+  ul_total_clocks += ul_benchmark_str_fnv(&uc_buff_test_15b[0]);
+  ul_total_clocks += ul_benchmark_str_fnv(&uc_buff_test_14b[0]);
+  ul_total_clocks += ul_benchmark_str_fnv(&uc_buff_test_13b[0]);
+
+  // strhash32:
+  ul_total_clocks = 0UL;
+  ul_total_clocks += ul_benchmark_str32(&uc_buff_test_128b[0]);
+  ul_total_clocks += ul_benchmark_str32(&uc_buff_test_16b[0]);
+  ul_total_clocks += ul_benchmark_str32(&uc_buff_test_15b[0]);
+  ul_total_clocks += ul_benchmark_str32(&uc_buff_test_14b[0]);
+  ul_total_clocks += ul_benchmark_str32(&uc_buff_test_13b[0]);
+
+  for (;;) {
+    __WFI();
+  }
+
+  return 0;
+}
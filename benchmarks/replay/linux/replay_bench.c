@@ -0,0 +1,119 @@
+/*
+ * Description:
+ *  Trace replay benchmark for string32 and standard library on Linux.
+ *  Clocks are nanoseconds of CLOCK_MONOTONIC.
+ *
+ * Build:
+ *  cc -O2 -I../../.. -I.. ../replay.c replay_bench.c ../../../string32.c -o replay_bench
+ *
+ * Usage:
+ *  ./replay_bench trace.bin [repeats]
+ *
+ * Author: 
+ *  Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "replay.h"
+
+#define REPLAY_ARENA_SIZE  (16UL * 1024UL * 1024UL)
+
+//--------------------------------------------//
+static uint64_t ull_clock_ns(void)
+{
+  struct timespec x_ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &x_ts);
+
+  return (uint64_t) x_ts.tv_sec * 1000000000ULL + (uint64_t) x_ts.tv_nsec;
+}
+
+static void putc_stdout(char c_sym)
+{
+  putchar(c_sym);
+}
+
+static replay_result_t x_result_std;
+static replay_result_t x_result_32;
+
+int main(int argc, char** argv)
+{
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s trace.bin [repeats]\n", argv[0]);
+    return 1;
+  }
+
+  unsigned long ul_repeats = (argc > 2) ? strtoul(argv[2], NULL, 0) : 1UL;
+
+  FILE* px_file = fopen(argv[1], "rb");
+  if (px_file == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  long l_trace_len = -1L;
+
+  if (fseek(px_file, 0L, SEEK_END) == 0) {
+    l_trace_len = ftell(px_file);
+  }
+
+  if ((l_trace_len < 0L) || (fseek(px_file, 0L, SEEK_SET) != 0)) {
+    perror(argv[1]);
+    fclose(px_file);
+    return 1;
+  }
+
+  // malloc() result is aligned enough for trace records
+  void* pv_trace = malloc((size_t) l_trace_len);
+  uint8_t* puc_arena = malloc(REPLAY_ARENA_SIZE);
+
+  if ((pv_trace == NULL) || (puc_arena == NULL)
+      || (fread(pv_trace, 1, (size_t) l_trace_len, px_file) != (size_t) l_trace_len)) {
+    fprintf(stderr, "can't load %s\n", argv[1]);
+    return 1;
+  }
+
+  fclose(px_file);
+
+  const replay_record_t* px_records;
+  size_t x_count;
+
+  if (!replay_parse(pv_trace, (size_t) l_trace_len, &px_records, &x_count)) {
+    fprintf(stderr, "%s is not a valid trace\n", argv[1]);
+    return 1;
+  }
+
+  string32_init();
+
+  // Warm up caches and branch predictors for both libraries
+  replay_result_t x_warmup = {0};
+  replay_run(px_records, x_count, puc_arena, REPLAY_ARENA_SIZE, true, ull_clock_ns, &x_warmup);
+  replay_run(px_records, x_count, puc_arena, REPLAY_ARENA_SIZE, false, ull_clock_ns, &x_warmup);
+
+  for (unsigned long ul_i = 0UL; ul_i < ul_repeats; ul_i++) {
+    replay_run(px_records, x_count, puc_arena, REPLAY_ARENA_SIZE, true, ull_clock_ns, &x_result_std);
+    replay_run(px_records, x_count, puc_arena, REPLAY_ARENA_SIZE, false, ull_clock_ns, &x_result_32);
+  }
+
+  printf("%zu records, %lu repeats, clocks in ns\n", x_count, ul_repeats);
+  replay_report(&x_result_std, &x_result_32, putc_stdout);
+
+  free(puc_arena);
+  free(pv_trace);
+
+  return 0;
+}
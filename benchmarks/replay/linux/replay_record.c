@@ -0,0 +1,98 @@
+/*
+ * Description:
+ *  Trace recorder for replay benchmark on Linux.
+ *  Every profiled call of string32 is written as replay_record_t.
+ *
+ * Author: 
+ *  Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+#include <stdio.h>
+#include "replay.h"
+#include "replay_record.h"
+
+#if (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "Trace is written in host byte order, but it must be little-endian"
+#endif
+
+static FILE* px_record_file;
+static replay_header_t x_record_header;
+
+//--------------------------------------------//
+/*
+ * @brief Hook for string32_profile_set_hook()
+ * @note Not thread safe, as profile table itself
+ */
+static void replay_record_hook(string32_profile_call_t const* px_call)
+{
+  replay_record_t x_rec;
+
+  replay_record_make(px_call, &x_rec);
+
+  if (fwrite(&x_rec, sizeof(x_rec), 1, px_record_file) == 1U) {
+    ++x_record_header.ul_count;
+  }
+}
+
+/*
+ * @brief Start to record all profiled calls into trace file
+ * @param *pc_path - Path of trace file, it will be overwritten
+ * @retval true if file is created
+ */
+bool replay_record_start(const char* pc_path)
+{
+  if (px_record_file != NULL) {
+    return false;
+  }
+
+  px_record_file = fopen(pc_path, "wb");
+
+  if (px_record_file == NULL) {
+    return false;
+  }
+
+  // Count is written by replay_record_stop()
+  x_record_header.ul_magic = REPLAY_TRACE_MAGIC;
+  x_record_header.ul_count = 0UL;
+
+  if (fwrite(&x_record_header, sizeof(x_record_header), 1, px_record_file) != 1U) {
+    fclose(px_record_file);
+    px_record_file = NULL;
+    return false;
+  }
+
+  string32_profile_set_hook(replay_record_hook);
+
+  return true;
+}
+
+/*
+ * @brief Stop recording and finish trace file
+ * @retval true if trace file is complete
+ */
+bool replay_record_stop(void)
+{
+  if (px_record_file == NULL) {
+    return false;
+  }
+
+  string32_profile_set_hook(NULL);
+
+  bool b_ok = (fseek(px_record_file, 0L, SEEK_SET) == 0)
+              && (fwrite(&x_record_header, sizeof(x_record_header), 1, px_record_file) == 1U);
+
+  b_ok = (fclose(px_record_file) == 0) && b_ok;
+  px_record_file = NULL;
+
+  return b_ok;
+}
@@ -0,0 +1,33 @@
+/*
+ * Description:
+ *  Trace recorder for replay benchmark on Linux.
+ *  Link it into application together with string32.c
+ *  built with _STRING32_LIB_PROFILE, e.g.:
+ *   cc -O2 -D_STRING32_LIB_PROFILE -D_STRING32_LIB_WRAP_STD \
+ *      -Wl,--wrap=memcpy,--wrap=memset,--wrap=memcmp,--wrap=strlen,--wrap=strcmp \
+ *      -I../../.. -I.. app.c ../replay.c replay_record.c ../../../string32.c -o app
+ *  and call replay_record_start("trace.bin") ... replay_record_stop().
+ *
+ * Author: 
+ *  Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+#ifndef _REPLAY_RECORD_H
+#define _REPLAY_RECORD_H
+
+#include <stdbool.h>
+
+bool replay_record_start(const char* pc_path);
+bool replay_record_stop(void);
+
+#endif /* _REPLAY_RECORD_H */
@@ -0,0 +1,359 @@
+/*
+ * Description:
+ *  Trace replay benchmark for string32 and standard library.
+ *  Common part for all targets.
+ *
+ * Author: 
+ *  Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+#include <string.h>
+#include "replay.h"
+
+// Keeps results of comparison and length functions alive
+static volatile size_t x_replay_sink;
+
+static const char* const pc_replay_names[STRING32_PROFILE_TOTAL] = {
+  "memcpy",
+  "memcmp",
+  "memset",
+  "strlen",
+};
+
+//--------------------------------------------//
+static uint32_t ul_replay_bucket(uint32_t ul_len)
+{
+  uint32_t ul_bucket = 0UL;
+
+  while (ul_len != 0UL) {
+    ++ul_bucket;
+    ul_len >>= 1;
+  }
+
+  return ul_bucket;
+}
+
+static void replay_puts(void (*pf_putc)(char c_sym), const char* pc_str)
+{
+  while (*pc_str != '\0') {
+    pf_putc(*pc_str);
+    ++pc_str;
+  }
+}
+
+static void replay_putu(void (*pf_putc)(char c_sym), uint64_t ull_val)
+{
+  char c_buff[20];
+  uint32_t ul_pos = 0UL;
+
+  do {
+    c_buff[ul_pos++] = (char) ('0' + (ull_val % 10U));
+    ull_val /= 10U;
+  } while (ull_val != 0ULL);
+
+  while (ul_pos--) {
+    pf_putc(c_buff[ul_pos]);
+  }
+}
+
+//--------------------------------------------//
+/*
+ * @brief Make trace record from profiled call
+ * @param *px_call - Call passed to hook of string32_profile_set_hook()
+ * @param *px_rec - Where to put record
+ * @note Distance is kept only for memcpy and memcmp, and only if it fits int32_t
+ * @retval none
+ */
+void replay_record_make(string32_profile_call_t const* px_call, replay_record_t* px_rec)
+{
+  uintptr_t x_dst = (uintptr_t) px_call->pv_dst;
+  uintptr_t x_src = (uintptr_t) px_call->pv_src;
+
+  px_rec->uc_func = (uint8_t) px_call->e_func;
+  px_rec->uc_align = (uint8_t) ((x_dst & 0x0FU) | ((x_src & 0x0FU) << 4));
+  px_rec->us_reserved = 0U;
+  px_rec->ul_len = (px_call->x_len > UINT32_MAX) ? UINT32_MAX : (uint32_t) px_call->x_len;
+  px_rec->l_distance = 0L;
+
+  if ((px_call->e_func == STRING32_PROFILE_MEMCPY) || (px_call->e_func == STRING32_PROFILE_MEMCMP)) {
+    intptr_t x_distance = (intptr_t) (x_src - x_dst);
+
+    if ((x_distance >= INT32_MIN) && (x_distance <= INT32_MAX)) {
+      px_rec->l_distance = (int32_t) x_distance;
+    }
+  }
+}
+
+/*
+ * @brief Check trace header and find records in it
+ * @param *pv_trace - Raw trace, aligned to 4 bytes
+ * @param x_trace_len - Size of raw trace in bytes
+ * @param **ppx_records - Pointer to first record
+ * @param *px_count - Number of records
+ * @retval true if trace is valid
+ */
+bool replay_parse(void const* pv_trace, size_t x_trace_len,
+                  const replay_record_t** ppx_records, size_t* px_count)
+{
+  replay_header_t const* px_header = (replay_header_t const*) pv_trace;
+
+  if ((x_trace_len < sizeof(replay_header_t)) || (px_header->ul_magic != REPLAY_TRACE_MAGIC)) {
+    return false;
+  }
+
+  if (px_header->ul_count > ((x_trace_len - sizeof(replay_header_t)) / sizeof(replay_record_t))) {
+    return false;
+  }
+
+  *ppx_records = (const replay_record_t*) (px_header + 1);
+  *px_count = px_header->ul_count;
+
+  return true;
+}
+
+/*
+ * @brief Find place in arena for single record
+ * @retval false if record can't be replayed
+ */
+static bool replay_prepare(replay_record_t const* px_rec, uint8_t* puc_arena, size_t x_arena_len,
+                           uint8_t** ppuc_dst, uint8_t** ppuc_src)
+{
+  size_t x_half = x_arena_len / 2;
+  size_t x_len = px_rec->ul_len;
+  size_t x_dst_align = px_rec->uc_align & 0x0F;
+  size_t x_src_align = px_rec->uc_align >> 4;
+
+  if ((px_rec->uc_func >= STRING32_PROFILE_TOTAL) || ((x_len + 16UL) >= x_half)) {
+    return false;
+  }
+
+  uint8_t* puc_dst = puc_arena + x_dst_align;
+  uint8_t* puc_src = puc_arena + x_half + x_src_align;
+
+  // Keep recorded distance when it fits and regions don't overlap
+  if (px_rec->l_distance != 0L) {
+    size_t x_dist = (px_rec->l_distance < 0L) ? (size_t) -(int64_t) px_rec->l_distance
+                                               : (size_t) px_rec->l_distance;
+
+    if ((x_dist >= x_len) && ((x_dist + x_len + 16UL) <= x_arena_len)) {
+      if (px_rec->l_distance > 0L) {
+        puc_src = puc_dst + x_dist;
+      } else {
+        puc_src = puc_arena + x_src_align;
+        puc_dst = puc_src + x_dist;
+      }
+    }
+  }
+
+  *ppuc_dst = puc_dst;
+  *ppuc_src = puc_src;
+
+  return true;
+}
+
+/*
+ * @brief Do single recorded call
+ * @note Terminator for strlen is placed by caller
+ */
+static void replay_call(uint8_t uc_func, uint8_t* puc_dst, uint8_t* puc_src, size_t x_len, bool b_std)
+{
+  switch (uc_func) {
+  case STRING32_PROFILE_MEMCPY:
+    if (b_std) {
+      memcpy(puc_dst, puc_src, x_len);
+    } else {
+      memcpy32(puc_dst, puc_src, x_len);
+    }
+    break;
+
+  case STRING32_PROFILE_MEMCMP:
+    x_replay_sink = b_std ? (size_t) memcmp(puc_dst, puc_src, x_len)
+                          : memcmp32(puc_dst, puc_src, x_len);
+    break;
+
+  case STRING32_PROFILE_MEMSET:
+    if (b_std) {
+      memset(puc_dst, 'a', x_len);
+    } else {
+      memset32(puc_dst, 'a', x_len);
+    }
+    break;
+
+  case STRING32_PROFILE_STRLEN:
+    x_replay_sink = b_std ? strlen((const char*) puc_src) : strlen32(puc_src);
+    break;
+
+  default:
+    break;
+  }
+}
+
+/*
+ * @brief Replay all records of trace once, and once more with every call timed
+ * @param *px_records - Trace records
+ * @param x_count - Number of records
+ * @param *puc_arena - Working memory for all calls
+ * @param x_arena_len - Size of working memory
+ * @param b_std - true to replay against <string.h>, false for string32.h
+ * @param pf_clock - Monotonic clock counter reader, it must not wrap during one pass
+ * @param *px_result - Where to accumulate wasted clocks
+ * @note Total clocks are taken from the first pass, which has no clock reads
+ *       between calls. Clocks of size buckets are taken from the second pass,
+ *       they include clock reading, which is removed as average by replay_report().
+ *       Records which can't fit in arena are skipped and counted.
+ * @retval none
+ */
+void replay_run(const replay_record_t* px_records, size_t x_count,
+                uint8_t* puc_arena, size_t x_arena_len, bool b_std,
+                replay_clock_t pf_clock, replay_result_t* px_result)
+{
+  // Same content in both halves, so memcmp always compare whole length
+  memset(puc_arena, 'a', x_arena_len);
+
+  // Cost of clock reading itself, the least one is the true cost
+  uint64_t ull_overhead = UINT64_MAX;
+
+  for (uint32_t ul_i = 0UL; ul_i < REPLAY_CLOCK_SAMPLES; ul_i++) {
+    uint64_t ull_sample = pf_clock();
+    ull_sample = pf_clock() - ull_sample;
+
+    if (ull_sample < ull_overhead) {
+      ull_overhead = ull_sample;
+    }
+  }
+
+  if ((px_result->ul_passes == 0UL) || (ull_overhead < px_result->ull_overhead)) {
+    px_result->ull_overhead = ull_overhead;
+  }
+
+  uint32_t ul_skipped = 0UL;
+  uint8_t* puc_dst;
+  uint8_t* puc_src;
+
+  // Whole trace at once
+  uint64_t ull_start = pf_clock();
+
+  for (size_t x_i = 0UL; x_i < x_count; x_i++) {
+    replay_record_t const* px_rec = &px_records[x_i];
+
+    if (!replay_prepare(px_rec, puc_arena, x_arena_len, &puc_dst, &puc_src)) {
+      ++ul_skipped;
+      continue;
+    }
+
+    if (px_rec->uc_func == STRING32_PROFILE_STRLEN) {
+      puc_src[px_rec->ul_len] = '\0';
+      replay_call(px_rec->uc_func, puc_dst, puc_src, px_rec->ul_len, b_std);
+      puc_src[px_rec->ul_len] = 'a';
+    } else {
+      replay_call(px_rec->uc_func, puc_dst, puc_src, px_rec->ul_len, b_std);
+    }
+  }
+
+  px_result->ull_total_clocks += pf_clock() - ull_start;
+  px_result->ul_skipped = ul_skipped;
+  ++px_result->ul_passes;
+
+  // Every call, for size buckets
+  for (size_t x_i = 0UL; x_i < x_count; x_i++) {
+    replay_record_t const* px_rec = &px_records[x_i];
+
+    if (!replay_prepare(px_rec, puc_arena, x_arena_len, &puc_dst, &puc_src)) {
+      continue;
+    }
+
+    if (px_rec->uc_func == STRING32_PROFILE_STRLEN) {
+      puc_src[px_rec->ul_len] = '\0';
+    }
+
+    ull_start = pf_clock();
+    replay_call(px_rec->uc_func, puc_dst, puc_src, px_rec->ul_len, b_std);
+    uint64_t ull_clocks = pf_clock() - ull_start;
+
+    if (px_rec->uc_func == STRING32_PROFILE_STRLEN) {
+      puc_src[px_rec->ul_len] = 'a';
+    }
+
+    uint32_t ul_bucket = ul_replay_bucket(px_rec->ul_len);
+
+    ++px_result->ul_calls[px_rec->uc_func][ul_bucket];
+    px_result->ull_clocks[px_rec->uc_func][ul_bucket] += ull_clocks;
+  }
+}
+
+/*
+ * @brief Average clocks of one call in bucket, without clock reading cost
+ */
+static uint64_t replay_average(const replay_result_t* px_result, uint32_t ul_func, uint32_t ul_bucket)
+{
+  uint64_t ull_calls = px_result->ul_calls[ul_func][ul_bucket];
+  uint64_t ull_overhead = ull_calls * px_result->ull_overhead;
+  uint64_t ull_clocks = px_result->ull_clocks[ul_func][ul_bucket];
+
+  if ((ull_calls == 0ULL) || (ull_clocks <= ull_overhead)) {
+    return 0ULL;
+  }
+
+  // Rounded to nearest
+  return (ull_clocks - ull_overhead + ull_calls / 2ULL) / ull_calls;
+}
+
+/*
+ * @brief Print wasted clocks of both libraries
+ * @param *px_std - Result for <string.h>
+ * @param *px_32 - Result for string32.h
+ * @param pf_putc - Function to put single char into UART, stdout, etc.
+ * @note Total is clocks of one pass over whole trace,
+ *       buckets show number of calls in trace and average clocks of one call
+ * @retval none
+ */
+void replay_report(const replay_result_t* px_std, const replay_result_t* px_32,
+                   void (*pf_putc)(char c_sym))
+{
+  if ((px_std->ul_passes == 0UL) || (px_32->ul_passes == 0UL)) {
+    return;
+  }
+
+  replay_puts(pf_putc, "total per pass: std ");
+  replay_putu(pf_putc, px_std->ull_total_clocks / px_std->ul_passes);
+  replay_puts(pf_putc, ", string32 ");
+  replay_putu(pf_putc, px_32->ull_total_clocks / px_32->ul_passes);
+  replay_puts(pf_putc, ", skipped ");
+  replay_putu(pf_putc, px_32->ul_skipped);
+  replay_puts(pf_putc, ", clock overhead ");
+  replay_putu(pf_putc, px_32->ull_overhead);
+  pf_putc('\n');
+
+  for (uint32_t ul_func = 0UL; ul_func < STRING32_PROFILE_TOTAL; ul_func++) {
+    for (uint32_t ul_bucket = 0UL; ul_bucket < REPLAY_SIZE_BUCKETS; ul_bucket++) {
+      if (px_32->ul_calls[ul_func][ul_bucket] == 0UL) {
+        continue;
+      }
+
+      uint64_t ull_low = (ul_bucket == 0UL) ? 0ULL : (1ULL << (ul_bucket - 1UL));
+
+      replay_puts(pf_putc, pc_replay_names[ul_func]);
+      replay_puts(pf_putc, " len ");
+      replay_putu(pf_putc, ull_low);
+      replay_puts(pf_putc, "..");
+      replay_putu(pf_putc, (ull_low == 0ULL) ? 0ULL : (2ULL * ull_low - 1ULL));
+      replay_puts(pf_putc, ": calls ");
+      replay_putu(pf_putc, px_32->ul_calls[ul_func][ul_bucket] / px_32->ul_passes);
+      replay_puts(pf_putc, ", avg std ");
+      replay_putu(pf_putc, replay_average(px_std, ul_func, ul_bucket));
+      replay_puts(pf_putc, ", string32 ");
+      replay_putu(pf_putc, replay_average(px_32, ul_func, ul_bucket));
+      pf_putc('\n');
+    }
+  }
+}
@@ -0,0 +1,71 @@
+/*
+ * Description:
+ *  Trace replay benchmark for string32 and standard library.
+ *  Common part for all targets.
+ *
+ * Trace format (little-endian):
+ *  replay_header_t, followed by replay_header_t.ul_count of replay_record_t.
+ *  Buffer with trace must be aligned to 4 bytes.
+ *  Records are made by replay_record_make() from string32_profile_set_hook(),
+ *  see linux/replay_record.c.
+ *
+ * Author: 
+ *  Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+#ifndef _REPLAY_H
+#define _REPLAY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string32.h>
+
+#define REPLAY_TRACE_MAGIC    0x54323353UL  // "S32T"
+#define REPLAY_SIZE_BUCKETS   33            // zero length and one per bit of uint32_t
+#define REPLAY_CLOCK_SAMPLES  1000UL        // clock reading cost is the least of them
+
+typedef struct {
+  uint32_t ul_magic;
+  uint32_t ul_count;
+} replay_header_t;
+
+typedef struct {
+  uint8_t uc_func;       // one of string32_profile_func_t
+  uint8_t uc_align;      // dst misalignment in low nibble, src in high nibble
+  uint16_t us_reserved;
+  uint32_t ul_len;       // size of data, or string length for strlen
+  int32_t l_distance;    // src - dst distance in bytes, 0 if unknown
+} replay_record_t;
+
+typedef struct {
+  uint32_t ul_calls[STRING32_PROFILE_TOTAL][REPLAY_SIZE_BUCKETS];    // timed calls of all passes
+  uint64_t ull_clocks[STRING32_PROFILE_TOTAL][REPLAY_SIZE_BUCKETS];  // clock reading included
+  uint64_t ull_total_clocks;  // whole trace passes, without clock reading between calls
+  uint64_t ull_overhead;      // least cost of clock reading
+  uint32_t ul_passes;
+  uint32_t ul_skipped;        // records skipped in one pass
+} replay_result_t;
+
+// Monotonic clock, e.g. nanoseconds or CPU cycles extended to 64bit
+typedef uint64_t (*replay_clock_t)(void);
+
+void replay_record_make(string32_profile_call_t const* px_call, replay_record_t* px_rec);
+bool replay_parse(void const* pv_trace, size_t x_trace_len,
+                  const replay_record_t** ppx_records, size_t* px_count);
+void replay_run(const replay_record_t* px_records, size_t x_count,
+                uint8_t* puc_arena, size_t x_arena_len, bool b_std,
+                replay_clock_t pf_clock, replay_result_t* px_result);
+void replay_report(const replay_result_t* px_std, const replay_result_t* px_32,
+                   void (*pf_putc)(char c_sym));
+
+#endif /* _REPLAY_H */
@@ -0,0 +1,120 @@
+/*
+ * Description:
+ *  Trace replay benchmark for string32 and standard library on STM32.
+ *
+ *  Trace must be linked in as uc_replay_trace[] and ul_replay_trace_len,
+ *  e.g. generated by "xxd -i trace.bin" with names changed
+ *  and __attribute__ ((aligned(4))) added.
+ *  Results are left in x_result_std and x_result_32 for debugger,
+ *  or printed by replay_report() if putc is implemented.
+ *
+ * ATTENTION!
+ * Result values in clocks may differ up to +/-6 clocks per call !
+ *
+ * Author: 
+ *  Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <string32.h>
+#include "replay.h"
+
+//--------------------------------------------//
+typedef struct {
+  uint32_t DWT_LAR;        // Lock Access Register  | 0xE0000FB0
+  uint32_t DWT_LSR;        // Lock Status Register  | 0xE0000FB4
+
+  uint32_t DWT_UNKNOWN[18];
+
+  uint32_t DWT_CTRL;       // Control Register      | 0xE0001000
+  uint32_t DWT_CYCCNT;     // Cycle Count Register  | 0xE0001004
+  // Rest of the registers is not used here
+} DWT_TypeDef;  // 0xE0000FB0 -> 0xE0000FB4
+
+/*
+ * ITM registers to perform clocks count
+ * For STM32 this registers are the same (mostly ?).
+ */
+#define SCB_DEMCR   *(volatile uint32_t* )0xE000EDFC // CoreDebug
+#define DWT         ((volatile DWT_TypeDef*) ((volatile uint32_t) 0xE0000FB0))
+
+const uint32_t DWT_LAR_MAGIC = 0xC5ACCE55;
+//--------------------------------------------//
+
+extern const uint8_t uc_replay_trace[];
+extern const uint32_t ul_replay_trace_len;
+
+// STM32F103 has 20KB of RAM, so keep arena small
+uint8_t uc_replay_arena[8 * 1024] __attribute__ ((aligned(4)));
+
+replay_result_t x_result_std;
+replay_result_t x_result_32;
+
+/*
+ * @brief Read DWT cycle counter extended to 64bit
+ * @note Counter wraps every 2^32 clocks (~59s at 72MHz),
+ *       so it must be read at least once per wrap, what replay_run() does
+ */
+uint64_t ull_clock_dwt(void)
+{
+  static uint32_t ul_last;
+  static uint64_t ull_high;
+
+  uint32_t ul_now = DWT->DWT_CYCCNT;
+
+  if (ul_now < ul_last) {
+    ull_high += 1ULL << 32;
+  }
+
+  ul_last = ul_now;
+
+  return ull_high | ul_now;
+}
+
+/*
+ * @brief Enables debug counter to mesure wasted clocks
+ * @retval none
+ */
+void init_dwt(void)
+{
+  DWT->DWT_LAR = DWT_LAR_MAGIC;  // unlock access to DWT (ITM, etc.)registers
+  SCB_DEMCR |= 0x01000000;       // enable trace
+
+  DWT->DWT_CTRL |= 1;         // enable the counter
+  DWT->DWT_CYCCNT = 0;        // reset the counter
+}
+
+int main(void)
+{
+  __disable_irq(); // __ASM volatile ("cpsid i");
+
+  init_dwt();
+  string32_init();
+
+  const replay_record_t* px_records;
+  size_t x_count;
+
+  if (replay_parse(&uc_replay_trace[0], ul_replay_trace_len, &px_records, &x_count)) {
+    replay_run(px_records, x_count, &uc_replay_arena[0], sizeof(uc_replay_arena),
+               true, ull_clock_dwt, &x_result_std);
+    replay_run(px_records, x_count, &uc_replay_arena[0], sizeof(uc_replay_arena),
+               false, ull_clock_dwt, &x_result_32);
+  }
+
+  for (;;) {
+    __WFI();
+  }
+
+  return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Description:
+ *  Benchmark of string32_init_sections() against one word per step
+ *  .data/.bss loop of vendor startup code, on Linux host.
+ *  Clocks are nanoseconds of CLOCK_MONOTONIC per call.
+ *
+ * Build:
+ *  cc -O2 -I../../.. startup_bench.c ../../../string32.c -o startup_bench
+ *
+ * Author: 
+ *  Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <string32.h>
+
+#define BENCH_REPEATS  20000UL
+
+//--------------------------------------------//
+// Sizes are in words: .data and .bss of typical STM32F103 firmware
+static uint32_t ul_data_lma[256];
+static uint32_t ul_data_vma[256];
+static uint32_t ul_bss[4096];
+
+static uint64_t ull_clock_ns(void)
+{
+  struct timespec x_ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &x_ts);
+
+  return (uint64_t) x_ts.tv_sec * 1000000000ULL + (uint64_t) x_ts.tv_nsec;
+}
+
+/*
+ * @brief Same loops as __cmsis_start() of CMSIS and Reset_Handler of vendor startup_*.s
+ * @note Without loop distribution, as real startup code can't call memcpy()/memset()
+ */
+__attribute__ ((noinline, optimize("O2", "no-tree-loop-distribute-patterns")))
+static void vendor_init_sections(const string32_copy_region_t* px_copy_start,
+                                 const string32_copy_region_t* px_copy_end,
+                                 const string32_zero_region_t* px_zero_start,
+                                 const string32_zero_region_t* px_zero_end)
+{
+  for (; px_copy_start < px_copy_end; ++px_copy_start) {
+    for (uint32_t ul_i = 0UL; ul_i < px_copy_start->ul_wlen; ++ul_i) {
+      px_copy_start->pul_dst[ul_i] = px_copy_start->pul_src[ul_i];
+    }
+  }
+
+  for (; px_zero_start < px_zero_end; ++px_zero_start) {
+    for (uint32_t ul_i = 0UL; ul_i < px_zero_start->ul_wlen; ++ul_i) {
+      px_zero_start->pul_dst[ul_i] = 0UL;
+    }
+  }
+}
+
+int main(void)
+{
+  // volatile, so compiler can't see tables and inline region sizes
+  static volatile string32_copy_region_t x_copy_table[1] = {
+    {&ul_data_lma[0], &ul_data_vma[0], sizeof(ul_data_vma) / sizeof(uint32_t)},
+  };
+  static volatile string32_zero_region_t x_zero_table[1] = {
+    {&ul_bss[0], sizeof(ul_bss) / sizeof(uint32_t)},
+  };
+
+  const string32_copy_region_t* px_copy = (const string32_copy_region_t*) &x_copy_table[0];
+  const string32_zero_region_t* px_zero = (const string32_zero_region_t*) &x_zero_table[0];
+
+  // x86_64 host, gcc -O2, 1KB .data and 16KB .bss:
+  //  ---------------------------------
+  // | func     | ns per call (2 runs) |
+  // |----------|----------------------|
+  // | vendor   |   1738  |   1994     |
+  // | string32 |    255  |    363     |
+  //  ---------------------------------
+  printf("%-10s %8s %8s %12s\n", "func", "data", "bss", "ns");
+
+  for (uint32_t ul_pass = 0UL; ul_pass < 2UL; ul_pass++) {
+    uint64_t ull_start = ull_clock_ns();
+
+    for (unsigned long ul_i = 0UL; ul_i < BENCH_REPEATS; ul_i++) {
+      if (ul_pass == 0UL) {
+        vendor_init_sections(px_copy, px_copy + 1, px_zero, px_zero + 1);
+      } else {
+        string32_init_sections(px_copy, px_copy + 1, px_zero, px_zero + 1);
+      }
+    }
+
+    uint64_t ull_clocks = ull_clock_ns() - ull_start;
+
+    printf("%-10s %8zu %8zu %12.1f\n", (ul_pass == 0UL) ? "vendor" : "string32",
+           sizeof(ul_data_vma), sizeof(ul_bss), (double) ull_clocks / (double) BENCH_REPEATS);
+  }
+
+  return 0;
+}
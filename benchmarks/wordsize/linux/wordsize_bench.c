@@ -0,0 +1,123 @@
+/*
+ * Description:
+ *  Side by side benchmark of 32bit and 64bit word kernels on Linux host.
+ *  Clocks are nanoseconds of CLOCK_MONOTONIC per call.
+ *
+ * Build:
+ *  cc -O2 -I../../.. wordsize_bench.c ../../../string32.c -o wordsize_bench
+ *
+ * Author: 
+ *  Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <string32.h>
+
+#define BENCH_REPEATS  100000UL
+
+//--------------------------------------------//
+typedef enum {
+  BENCH_MEMCPY = 0,
+  BENCH_MEMCMP,
+  BENCH_MEMSET,
+  BENCH_STRLEN,
+
+  BENCH_TOTAL
+} bench_func_t;
+
+static const char* const pc_bench_names[BENCH_TOTAL] = {
+  "memcpy",
+  "memcmp",
+  "memset",
+  "strlen",
+};
+
+static uint8_t uc_buff_src[4096 + 8] __attribute__ ((aligned(8)));
+static uint8_t uc_buff_dst[4096 + 8] __attribute__ ((aligned(8)));
+static volatile size_t x_bench_sink;
+
+static uint64_t ull_clock_ns(void)
+{
+  struct timespec x_ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &x_ts);
+
+  return (uint64_t) x_ts.tv_sec * 1000000000ULL + (uint64_t) x_ts.tv_nsec;
+}
+
+static double benchmark(bench_func_t e_func, bool b_wide, size_t x_size)
+{
+  uc_buff_src[x_size] = '\0';
+
+  uint64_t ull_start = ull_clock_ns();
+
+  for (unsigned long ul_i = 0UL; ul_i < BENCH_REPEATS; ul_i++) {
+    switch (e_func) {
+    case BENCH_MEMCPY:
+      x_bench_sink = (size_t) (b_wide ? memcpy64(uc_buff_dst, uc_buff_src, x_size)
+                                      : memcpy32(uc_buff_dst, uc_buff_src, x_size));
+      break;
+
+    case BENCH_MEMCMP:
+      x_bench_sink = b_wide ? memcmp64(uc_buff_dst, uc_buff_src, x_size)
+                            : memcmp32(uc_buff_dst, uc_buff_src, x_size);
+      break;
+
+    case BENCH_MEMSET:
+      x_bench_sink = (size_t) (b_wide ? memset64(uc_buff_dst, 0x1FF, x_size)
+                                      : memset32(uc_buff_dst, 0x1FF, x_size));
+      break;
+
+    case BENCH_STRLEN:
+      x_bench_sink = b_wide ? strlen64(uc_buff_src) : strlen32(uc_buff_src);
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  uint64_t ull_clocks = ull_clock_ns() - ull_start;
+
+  uc_buff_src[x_size] = 'a';
+
+  return (double) ull_clocks / (double) BENCH_REPEATS;
+}
+
+int main(void)
+{
+  const size_t x_sizes[] = {16, 125, 128, 1024, 4096};
+
+  memset(uc_buff_src, 'a', sizeof(uc_buff_src));
+  memset(uc_buff_dst, 'a', sizeof(uc_buff_dst));
+
+  printf("%-8s %6s %10s %10s\n", "func", "size", "32bit ns", "64bit ns");
+
+  for (uint32_t ul_func = 0UL; ul_func < BENCH_TOTAL; ul_func++) {
+    for (size_t x_i = 0UL; x_i < (sizeof(x_sizes) / sizeof(x_sizes[0])); x_i++) {
+      // memcmp needs equal buffers to compare whole length
+      memset(uc_buff_dst, 'a', sizeof(uc_buff_dst));
+
+      printf("%-8s %6zu %10.1f %10.1f\n", pc_bench_names[ul_func], x_sizes[x_i],
+             benchmark((bench_func_t) ul_func, false, x_sizes[x_i]),
+             benchmark((bench_func_t) ul_func, true, x_sizes[x_i]));
+    }
+  }
+
+  return 0;
+}
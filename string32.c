@@ -22,10 +22,20 @@
 
 #include "string32.h"
 
+#ifdef _STRING32_LIB_PARALLEL_PTHREAD
+#include <pthread.h>
+#endif
+
+#ifdef _STRING32_LIB_PARALLEL_RP2040
+#include "pico/multicore.h"
+#endif
+
 
 #ifdef __GNUC__
 // Fits for GCC
-#define _STRING32_LIB_OPTIMIZE_ATTR  __attribute__ ((optimize("O2")))
+// Kernels loops must not be turned back into libc memcpy()/memset() calls:
+// it is recursion in drop-in mode and libc code before C runtime init in startup
+#define _STRING32_LIB_OPTIMIZE_ATTR  __attribute__ ((optimize("O2", "no-tree-loop-distribute-patterns")))
 #endif // __GNUC__
 
 #ifdef __ICCARM__
@@ -44,49 +54,96 @@
 // This can improve overall safety, but behavor will not like STD Lib.
 //#define _STRING32_LIB_OPTIMIZE_NULL_CHECK
 
+// Enable one of this rules to use string32 for whole firmware image,
+// including libc internals, vendor HAL and memcpy()/memset() calls emitted by compiler:
+//  _STRING32_LIB_REPLACE_STD - define memcpy, memset, memcmp, strlen and strcmp;
+//  _STRING32_LIB_WRAP_STD - define __wrap_memcpy, etc. for -Wl,--wrap=memcpy,...
+// If compiler is not GCC, string32.c must be built with -fno-builtin
+// or -ffreestanding, so kernels are not turned into calls to themselves.
+//#define _STRING32_LIB_REPLACE_STD
+//#define _STRING32_LIB_WRAP_STD
 
+// Enable one of this rules to get worker pool for memcpy32_parallel()/memset32_parallel():
+//  _STRING32_LIB_PARALLEL_PTHREAD - string32_pool_pthread_init(), for Linux and other POSIX;
+//  _STRING32_LIB_PARALLEL_RP2040 - string32_pool_rp2040_init(), second core via pico-sdk.
+//#define _STRING32_LIB_PARALLEL_PTHREAD
+//#define _STRING32_LIB_PARALLEL_RP2040
 
-/* =================== Copying ======================= */
+// Chunks of parallel functions are aligned to it
+#ifndef _STRING32_LIB_CACHE_LINE
+#define _STRING32_LIB_CACHE_LINE  64UL
+#endif
 
-/*
- * @brief Copy block of memory
- * @param *pv_dst - Pointer to the destination array where the content is to be copied
- * @param *pv_src - Pointer to the source of data to be copied
- * @param x_len - Number of bytes to copy
- * @retval destination buffer pointer
- */
-_STRING32_LIB_OPTIMIZE_ATTR
-void* memcpy32(void* pv_dst, void const* pv_src, size_t x_len)
-{
-#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
-  if ((pv_dst == NULL) || (pv_src == NULL)) {
-    return NULL;
-  }
+// Enable this rule to select kernels at runtime, according to CPU capability.
+// On Linux public functions are bound once by GNU ifunc,
+// on Microcontrollers string32_init() must be called before first use.
+//#define _STRING32_LIB_DISPATCH
+
+
+// Enable this rule to collect calls count, size and alignment histograms
+// for every kernel into static table. See string32_profile_dump().
+// Define _STRING32_LIB_PROFILE_CLOCK() to clock counter reader
+// to collect wasted clocks too, e.g. for DWT:
+//   #define _STRING32_LIB_PROFILE_CLOCK()  (*(volatile uint32_t*) 0xE0001004)
+//#define _STRING32_LIB_PROFILE
+
+
+#if defined(_STRING32_LIB_DISPATCH) || defined(_STRING32_LIB_PROFILE)
+// Word kernels become one of variants and public names are defined
+// in Dispatching section at the end of this file
+#define _STRING32_KERNEL(x_name)  x_name##_word
+#define _STRING32_KERNEL_LINKAGE  static
+#else
+#define _STRING32_KERNEL(x_name)  x_name
+#define _STRING32_KERNEL_LINKAGE
+#endif // _STRING32_LIB_DISPATCH || _STRING32_LIB_PROFILE
+
+// 64bit kernels are one of variants on hosts with 64bit ABI
+#if defined(_STRING32_LIB_DISPATCH) && (defined(__x86_64__) || defined(__aarch64__) \
+ || defined(__powerpc64__) || (defined(__riscv) && (__riscv_xlen == 64)))
+#define _STRING32_LIB_DISPATCH_WIDE
 #endif
 
-  uint32_t* pul_dst = (uint32_t*) pv_dst;
-  uint32_t const* pul_src = (uint32_t const*) pv_src;
+// Profiling needs a wrapper around every call, so ifunc is not used with it
+#if defined(_STRING32_LIB_DISPATCH) && !defined(_STRING32_LIB_PROFILE) \
+ && defined(__GNUC__) && defined(__ELF__) && defined(__linux__)
+#define _STRING32_LIB_DISPATCH_IFUNC
+#endif
 
-  while (x_len >= sizeof(uint32_t)) {
-    *pul_dst = *pul_src;
+// Standard names can be called with any pointers, including from libc and HAL,
+// so they use kernels which never do unaligned word access
+#if defined(_STRING32_LIB_DISPATCH) || defined(_STRING32_LIB_REPLACE_STD) \
+ || defined(_STRING32_LIB_WRAP_STD)
+#define _STRING32_LIB_ALIGNED_KERNELS
+#endif
 
-    ++pul_dst;
-    ++pul_src;
-    x_len -= sizeof(uint32_t);
-  }
 
-  uint8_t* puc_dst = (uint8_t*) pul_dst;
-  uint8_t const* puc_src = (uint8_t const*) pul_src;
 
-  while (x_len--) {
-    *puc_dst = *puc_src;
+#define _STRING32_IS_ALIGNED(x_ptr)  ((((uintptr_t) (x_ptr)) & (sizeof(uint32_t) - 1)) == 0UL)
 
-    ++puc_dst;
-    ++puc_src;
-  }
 
-  return pv_dst;
-}
+
+/* ================== Word kernels =================== */
+
+// memcpy32(), memcmp32(), memset32(), strlen32()
+#define _STRING32_WORD_T            uint32_t
+#define _STRING32_WORD_NAME(x_name) _STRING32_KERNEL(x_name##32)
+#define _STRING32_WORD_LINKAGE      _STRING32_KERNEL_LINKAGE
+#define _STRING32_WORD_CTZ(x_word)  __builtin_ctz(x_word)
+#define _STRING32_WORD_CLZ(x_word)  __builtin_clz(x_word)
+#include "string32_word.h"
+
+// memcpy64(), memcmp64(), memset64(), strlen64()
+#define _STRING32_WORD_T            uint64_t
+#define _STRING32_WORD_NAME(x_name) x_name##64
+#define _STRING32_WORD_LINKAGE
+#define _STRING32_WORD_CTZ(x_word)  __builtin_ctzll(x_word)
+#define _STRING32_WORD_CLZ(x_word)  __builtin_clzll(x_word)
+#include "string32_word.h"
+
+
+/* =================== Copying ======================= */
+// memcpy32() is made from string32_word.h
 
 /*
  * @brief Copies the C string
@@ -156,170 +213,2252 @@ char* strcat32(char* pc_dst, const char* pc_src)
 }
 
 /* ================== Comparison ===================== */
+// memcmp32() is made from string32_word.h
 
 /*
- * @brief Compare two blocks of memory 
- * @param *pv_ptr1 - Pointer to block of memory
- * @param *pv_ptr2 - Pointer to block of memory
- * @param x_len - Number of bytes to compare
- * @retval -1,0,+1 according to original memcmp
+ * @brief Compares the C string str1 to the C string str2
+ * @param *pc_str1 - C string to be compared
+ * @param *pc_str2 - C string to be compared
+ * @retval -1,0,+1 according to original strcmp
  */
 _STRING32_LIB_OPTIMIZE_ATTR
-size_t memcmp32(void const* pv_ptr1, void const* pv_ptr2, size_t x_len)
+size_t strcmp32(const char* pc_str1, const char* pc_str2)
 {
 #ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
-  if ((pv_ptr1 == NULL) || (pv_ptr2 == NULL)) {
+  if ((pc_str1 == NULL) || (pc_str2 == NULL)) {
     return 0UL;
   }
 #endif
 
-  uint32_t const *pul_ptr1 = (uint32_t const *) pv_ptr1;
-  uint32_t const *pul_ptr2 = (uint32_t const *) pv_ptr2;
+  // Terminator is compared too, so shorter string is always less
+  return memcmp32(pc_str1, pc_str2, strlen32(pc_str1) + 1);
+}
 
-  size_t x_res = 0L;
+/* ================== Searching ====================== */
+// TODO: fill averything here
+// memchr
+// strchr
 
-  if (pul_ptr1 == pul_ptr2) {
-    goto MEMCMP32_DONE_END;
-  } else {
-    while (x_len >= sizeof(uint32_t)) {
-      if (*pul_ptr1 != *pul_ptr2) {
-        x_res = (*pul_ptr1 > *pul_ptr2) ? 1 : -1;
-        goto MEMCMP32_DONE_END;
-      }
+/*
+ * @brief Check that whole block of memory is filled with one byte value
+ * @param *pv_src - Pointer to the block of memory to check
+ * @param uc_val - Byte value expected in every position (0xFF for erased flash)
+ * @param x_len - Number of bytes to check
+ * @retval true if every byte is equal to uc_val
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+bool memis32(void const* pv_src, uint8_t uc_val, size_t x_len)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if (pv_src == NULL) {
+    return false;
+  }
+#endif
 
-      ++pul_ptr1;
-      ++pul_ptr2;
-      x_len -= sizeof(uint32_t);
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+
+  // Words are read only from aligned addresses
+  while ((x_len != 0UL) && !_STRING32_IS_ALIGNED(puc_src)) {
+    if (*puc_src != uc_val) {
+      return false;
     }
 
-    uint8_t const *puc_ptr1 = (uint8_t const *) pul_ptr1;
-    uint8_t const *puc_ptr2 = (uint8_t const *) pul_ptr2;
+    ++puc_src;
+    --x_len;
+  }
 
-    while (x_len--) {
-      if (*puc_ptr1 != *puc_ptr2) {
-        x_res = (*puc_ptr1 > *puc_ptr2) ? 1 : -1;
-        goto MEMCMP32_DONE_END;
-      }
+  uint32_t const* pul_src = (uint32_t const*) puc_src;
+  uint32_t ul_pattern = (uint32_t) uc_val * 0x01010101UL;
 
-      ++puc_ptr1;
-      ++puc_ptr2;
+  // Four words per step, mismatches are accumulated by OR
+  // so there is only one branch for every 16 bytes
+  while (x_len >= (4 * sizeof(uint32_t))) {
+    if (((pul_src[0] ^ ul_pattern) | (pul_src[1] ^ ul_pattern) |
+         (pul_src[2] ^ ul_pattern) | (pul_src[3] ^ ul_pattern)) != 0UL) {
+      return false;
     }
+
+    pul_src += 4;
+    x_len -= (4 * sizeof(uint32_t));
   }
 
-  MEMCMP32_DONE_END:
-  return x_res;
+  while (x_len >= sizeof(uint32_t)) {
+    if (*pul_src != ul_pattern) {
+      return false;
+    }
+
+    ++pul_src;
+    x_len -= sizeof(uint32_t);
+  }
+
+  puc_src = (uint8_t const*) pul_src;
+
+  while (x_len--) {
+    if (*puc_src != uc_val) {
+      return false;
+    }
+
+    ++puc_src;
+  }
+
+  return true;
 }
 
 /*
- * @brief Compares the C string str1 to the C string str2
- * @param *pc_str1 - C string to be compared
- * @param *pc_str2 - C string to be compared
- * @retval -1,0,+1 according to original strcmp
+ * @brief Find first byte which is not equal to value
+ * @param *pv_src - Pointer to the block of memory to check
+ * @param uc_val - Byte value expected in every position
+ * @param x_len - Number of bytes to check
+ * @retval offset of the first mismatched byte, or x_len if there is none
  */
 _STRING32_LIB_OPTIMIZE_ATTR
-size_t strcmp32(const char* pc_str1, const char* pc_str2)
+size_t memfirstnot32(void const* pv_src, uint8_t uc_val, size_t x_len)
 {
 #ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
-  if ((pc_str1 == NULL) || (pc_str2 == NULL)) {
+  if (pv_src == NULL) {
     return 0UL;
   }
 #endif
 
-  return memcmp32(pc_str1, pc_str2, strlen32(pc_str1));
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+
+  // Words are read only from aligned addresses
+  while ((x_len != 0UL) && !_STRING32_IS_ALIGNED(puc_src)) {
+    if (*puc_src != uc_val) {
+      return (size_t)(puc_src - (uint8_t const*) pv_src);
+    }
+
+    ++puc_src;
+    --x_len;
+  }
+
+  uint32_t const* pul_src = (uint32_t const*) puc_src;
+  uint32_t ul_pattern = (uint32_t) uc_val * 0x01010101UL;
+
+  while (x_len >= (4 * sizeof(uint32_t))) {
+    if (((pul_src[0] ^ ul_pattern) | (pul_src[1] ^ ul_pattern) |
+         (pul_src[2] ^ ul_pattern) | (pul_src[3] ^ ul_pattern)) != 0UL) {
+      break;
+    }
+
+    pul_src += 4;
+    x_len -= (4 * sizeof(uint32_t));
+  }
+
+  while (x_len >= sizeof(uint32_t)) {
+    if (*pul_src != ul_pattern) {
+      break;
+    }
+
+    ++pul_src;
+    x_len -= sizeof(uint32_t);
+  }
+
+  // Mismatched word (if any) is still ahead,
+  // so bytes loop will point exact position regardless of endianness
+  puc_src = (uint8_t const*) pul_src;
+
+  while (x_len--) {
+    if (*puc_src != uc_val) {
+      break;
+    }
+
+    ++puc_src;
+  }
+
+  return (size_t)(puc_src - (uint8_t const*) pv_src);
 }
 
-/* ================== Searching ====================== */
-// TODO: fill averything here
-// memchr
-// strchr
 
+/* ===================== UTF-8 ======================= */
 
-/* ==================== Other ======================== */
+/*
+ * @brief Count code points of UTF-8 C string
+ * @param *pv_src - UTF-8 C string
+ * @note Words are read only from aligned addresses, so it never reads
+ *       outside of aligned word which hold terminator.
+ *       Invalid sequences are not checked, see utf8valid32().
+ * @retval number of code points
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+size_t utf8len32(void const* pv_src)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if (pv_src == NULL) {
+    return 0UL;
+  }
+#endif
+
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+  size_t x_cont = 0UL;  // continuation bytes found
+
+  while (!_STRING32_IS_ALIGNED(puc_src)) {
+    if (*puc_src == '\0') {
+      return (size_t)(puc_src - (uint8_t const*) pv_src) - x_cont;
+    }
+
+    x_cont += ((*puc_src & 0xC0) == 0x80) ? 1UL : 0UL;
+    ++puc_src;
+  }
+
+  uint32_t const* pul_src = (uint32_t const*) puc_src;
+
+  for (;;) {
+    uint32_t ul_word_chunk = *pul_src;
+
+    if (((ul_word_chunk - 0x01010101UL) & ~ul_word_chunk & 0x80808080UL) != 0UL) {
+      break;
+    }
+
+    // Pure ASCII words are skipped by one test
+    if ((ul_word_chunk & 0x80808080UL) != 0UL) {
+      // 10xxxxxx: high bit set and next one clear
+      uint32_t ul_cont = ul_word_chunk & ~(ul_word_chunk << 1) & 0x80808080UL;
+
+      // Sum of marks in the highest byte
+      x_cont += (uint32_t) ((ul_cont >> 7) * 0x01010101UL) >> 24;
+    }
+
+    ++pul_src;
+  }
+
+  puc_src = (uint8_t const*) pul_src;
+
+  while (*puc_src != '\0') {
+    x_cont += ((*puc_src & 0xC0) == 0x80) ? 1UL : 0UL;
+    ++puc_src;
+  }
+
+  return (size_t)(puc_src - (uint8_t const*) pv_src) - x_cont;
+}
 
 /*
- * @brief Fill block of memory
- * @param *pv_dst - Pointer to the block of memory to fill
- * @param *ul_val - Pattern to be set
- * @param x_len - Number of bytes to be set to the Pattern
- * @retval destination buffer pointer
+ * @brief Check that block of memory is valid UTF-8 (RFC 3629)
+ * @param *pv_src - Pointer to the block of memory to check
+ * @param x_len - Number of bytes to check
+ * @note Overlong forms, surrogates and code points above U+10FFFF are invalid.
+ *       Never reads outside of x_len bytes.
+ * @retval true if whole block is valid UTF-8
  */
 _STRING32_LIB_OPTIMIZE_ATTR
-void* memset32(void* pv_dst, uint32_t ul_val, size_t x_len)
+bool utf8valid32(void const* pv_src, size_t x_len)
 {
 #ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
-  if (pv_dst == NULL) {
-    return NULL;
+  if (pv_src == NULL) {
+    return false;
   }
 #endif
 
-  uint32_t* pul_dst = (uint32_t*) pv_dst;
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
 
-  if (x_len > sizeof(uint32_t)) {
-    if (ul_val != 0) {
-      if (ul_val <= 0x000000FF) {
-        ul_val |= (ul_val << 8) | (ul_val << 16) | (ul_val << 24);
-      } else if ((ul_val & 0xFFFF0000) == 0UL) {
-        ul_val |= (ul_val << 16);
+  while (x_len != 0UL) {
+    if (_STRING32_IS_ALIGNED(puc_src)) {
+      uint32_t const* pul_src = (uint32_t const*) puc_src;
+
+      // Eight ASCII bytes are checked by one test
+      while ((x_len >= (2 * sizeof(uint32_t)))
+             && (((pul_src[0] | pul_src[1]) & 0x80808080UL) == 0UL)) {
+        pul_src += 2;
+        x_len -= (2 * sizeof(uint32_t));
+      }
+
+      puc_src = (uint8_t const*) pul_src;
+
+      if (x_len == 0UL) {
+        break;
       }
     }
 
-    do {
-      *pul_dst = ul_val;
-      ++pul_dst;
-      x_len -= sizeof(uint32_t);
-    } while (x_len >= sizeof(uint32_t));
+    uint8_t uc_lead = *puc_src;
+
+    if (uc_lead < 0x80) {
+      ++puc_src;
+      --x_len;
+      continue;
+    }
+
+    // Allowed range of the second byte depends on lead byte
+    size_t x_tail = 0UL;
+    uint8_t uc_low = 0x80;
+    uint8_t uc_high = 0xBF;
+
+    if ((uc_lead >= 0xC2) && (uc_lead <= 0xDF)) {
+      x_tail = 1UL;
+    } else if (uc_lead == 0xE0) {
+      x_tail = 2UL;
+      uc_low = 0xA0;  // overlong
+    } else if (uc_lead == 0xED) {
+      x_tail = 2UL;
+      uc_high = 0x9F;  // surrogates
+    } else if ((uc_lead >= 0xE1) && (uc_lead <= 0xEF)) {
+      x_tail = 2UL;
+    } else if (uc_lead == 0xF0) {
+      x_tail = 3UL;
+      uc_low = 0x90;  // overlong
+    } else if ((uc_lead >= 0xF1) && (uc_lead <= 0xF3)) {
+      x_tail = 3UL;
+    } else if (uc_lead == 0xF4) {
+      x_tail = 3UL;
+      uc_high = 0x8F;  // above U+10FFFF
+    } else {
+      return false;
+    }
+
+    if ((x_len <= x_tail) || (puc_src[1] < uc_low) || (puc_src[1] > uc_high)) {
+      return false;
+    }
+
+    for (size_t x_i = 2UL; x_i <= x_tail; x_i++) {
+      if ((puc_src[x_i] & 0xC0) != 0x80) {
+        return false;
+      }
+    }
+
+    puc_src += x_tail + 1UL;
+    x_len -= x_tail + 1UL;
+  }
+
+  return true;
+}
+
+/* ===================== Codecs ====================== */
+
+// ASCII to hex digit value, 0x80 for invalid char
+static const uint8_t uc_string32_hex_dec[128] = {
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+// Base64 alphabet (RFC 4648), terminator is kept for C++ builds
+static const char c_string32_b64_enc[65] =
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// ASCII to Base64 digit value, 0x80 for invalid char and padding
+static const uint8_t uc_string32_b64_dec[128] = {
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3E, 0x80, 0x80, 0x80, 0x3F,
+  0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+  0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+/*
+ * @brief Load 32bit little-endian word from any address
+ * @note Compiler choose single load or bytes loads according to target,
+ *       so it is safe on Cortex-M0 too
+ */
+static inline uint32_t string32_load_le32(void const* pv_src)
+{
+#ifdef __GNUC__
+  uint32_t ul_val;
+
+  __builtin_memcpy(&ul_val, pv_src, sizeof(ul_val));
+#if (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  ul_val = __builtin_bswap32(ul_val);
+#endif
+
+  return ul_val;
+#else
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+
+  return (uint32_t) puc_src[0] | ((uint32_t) puc_src[1] << 8)
+         | ((uint32_t) puc_src[2] << 16) | ((uint32_t) puc_src[3] << 24);
+#endif
+}
+
+/*
+ * @brief Store 32bit little-endian word to any address
+ */
+static inline void string32_store_le32(void* pv_dst, uint32_t ul_val)
+{
+#ifdef __GNUC__
+#if (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  ul_val = __builtin_bswap32(ul_val);
+#endif
+
+  __builtin_memcpy(pv_dst, &ul_val, sizeof(ul_val));
+#else
+  uint8_t* puc_dst = (uint8_t*) pv_dst;
+
+  puc_dst[0] = (uint8_t) ul_val;
+  puc_dst[1] = (uint8_t) (ul_val >> 8);
+  puc_dst[2] = (uint8_t) (ul_val >> 16);
+  puc_dst[3] = (uint8_t) (ul_val >> 24);
+#endif
+}
+
+/*
+ * @brief Make four hex chars from two bytes
+ * @param ul_val - First byte in bits 0..7, second one in bits 8..15
+ * @retval chars as little-endian word
+ */
+static inline uint32_t string32_hex_word(uint32_t ul_val)
+{
+  // Spread bytes to 16bit lanes, then nibbles to bytes in print order
+  ul_val = (ul_val & 0x000000FFUL) | ((ul_val & 0x0000FF00UL) << 8);
+  ul_val = ((ul_val >> 4) & 0x000F000FUL) | ((ul_val & 0x000F000FUL) << 8);
+
+  // '0' for every nibble, plus ('a' - '0' - 10) for nibbles above 9
+  return ul_val + 0x30303030UL + (((ul_val + 0x06060606UL) >> 4) & 0x01010101UL) * 0x27UL;
+}
+
+/*
+ * @brief Encode block of memory to lowercase hex
+ * @param *pc_dst - Destination, at least STRING32_HEXENC_LEN(x_len) chars
+ * @param *pv_src - Pointer to the data to be encoded
+ * @param x_len - Number of bytes to encode
+ * @note Terminator is not added
+ * @retval number of chars written
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+size_t hexenc32(char* pc_dst, void const* pv_src, size_t x_len)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if ((pc_dst == NULL) || (pv_src == NULL)) {
+    return 0UL;
   }
+#endif
+
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+  char* pc_out = pc_dst;
+
+  // Word of source gives two words of chars
+  while (x_len >= sizeof(uint32_t)) {
+    uint32_t ul_val = string32_load_le32(puc_src);
+
+    string32_store_le32(pc_out, string32_hex_word(ul_val));
+    string32_store_le32(pc_out + sizeof(uint32_t), string32_hex_word(ul_val >> 16));
 
-  uint8_t* puc_dst = (uint8_t*) pul_dst;
+    puc_src += sizeof(uint32_t);
+    pc_out += 2 * sizeof(uint32_t);
+    x_len -= sizeof(uint32_t);
+  }
 
   while (x_len--) {
-    *puc_dst = (uint8_t) ul_val;
-    ++puc_dst;
+    uint32_t ul_chars = string32_hex_word(*puc_src);
+
+    pc_out[0] = (char) ul_chars;
+    pc_out[1] = (char) (ul_chars >> 8);
+
+    ++puc_src;
+    pc_out += 2;
   }
 
-  return pv_dst;
+  return (size_t) (pc_out - pc_dst);
 }
 
 /*
- * @brief Get string length
- * @param *pv_src - C string
- * @retval the length of string
+ * @brief Decode hex chars to block of memory
+ * @param *pv_dst - Destination, at least STRING32_HEXDEC_LEN(x_len) bytes
+ * @param *pc_src - Hex chars, any case
+ * @param x_len - Number of chars to decode
+ * @note Never reads outside of x_len chars.
+ *       Destination may be partly written if input is invalid.
+ * @retval number of bytes written, or STRING32_CODEC_ERROR for odd length or invalid char
  */
 _STRING32_LIB_OPTIMIZE_ATTR
-size_t strlen32(void const* pv_src)
+size_t hexdec32(void* pv_dst, const char* pc_src, size_t x_len)
 {
 #ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
-  if (pv_src == NULL) {
-    return 0UL;
+  if ((pv_dst == NULL) || (pc_src == NULL)) {
+    return STRING32_CODEC_ERROR;
   }
 #endif
 
-  uint32_t const *pul_src = (uint32_t const*) pv_src;
-  uint32_t ul_word_chunk = *pul_src;
-  uint32_t ul_offset = 0UL;
+  if ((x_len & 1UL) != 0UL) {
+    return STRING32_CODEC_ERROR;
+  }
 
-  // Idea based on concept when we trying to
-  // discover '\0' at end of the sting splitted to word chunks
-  do {
-    if((ul_word_chunk & 0x000000FF) == 0UL) {
-      ul_offset = 0UL;
-      goto STRLEN32_DONE_END;
-    } else if((ul_word_chunk & 0x0000FF00) == 0UL) {
-      ul_offset = 1UL;
-      goto STRLEN32_DONE_END;
-    } else if((ul_word_chunk & 0x00FF0000) == 0UL) {
-      ul_offset = 2UL;
-      goto STRLEN32_DONE_END;
-    } else if((ul_word_chunk & 0xFF000000) == 0UL) {
-      ul_offset = 3UL;
-      goto STRLEN32_DONE_END;
+  uint8_t* puc_dst = (uint8_t*) pv_dst;
+
+  // Two words of chars give word of data
+  while (x_len >= (2 * sizeof(uint32_t))) {
+    uint32_t ul_lo = string32_load_le32(pc_src);
+    uint32_t ul_hi = string32_load_le32(pc_src + sizeof(uint32_t));
+
+    if (((ul_lo | ul_hi) & 0x80808080UL) != 0UL) {
+      return STRING32_CODEC_ERROR;
     }
 
-    ++pul_src;
-    ul_word_chunk = *pul_src;
-  } while (1UL);
+    uint32_t ul_val = 0UL;
+    uint8_t uc_bad = 0U;
+
+    for (uint32_t ul_i = 0UL; ul_i < 8UL; ul_i += 2UL) {
+      uint32_t ul_pair = (ul_i < 4UL) ? (ul_lo >> (ul_i * 8UL)) : (ul_hi >> ((ul_i - 4UL) * 8UL));
+      uint8_t uc_high = uc_string32_hex_dec[ul_pair & 0x7F];
+      uint8_t uc_low = uc_string32_hex_dec[(ul_pair >> 8) & 0x7F];
+
+      uc_bad |= uc_high | uc_low;
+      ul_val |= (uint32_t) ((uc_high << 4) | uc_low) << (ul_i * 4UL);
+    }
+
+    // All invalid chars are found by one test
+    if ((uc_bad & 0x80U) != 0U) {
+      return STRING32_CODEC_ERROR;
+    }
 
-  STRLEN32_DONE_END:
+    string32_store_le32(puc_dst, ul_val);
 
-  return (size_t)((const uint8_t *) pul_src - (const uint8_t *) pv_src + ul_offset);
+    pc_src += 2 * sizeof(uint32_t);
+    puc_dst += sizeof(uint32_t);
+    x_len -= 2 * sizeof(uint32_t);
+  }
+
+  while (x_len != 0UL) {
+    uint8_t uc_high = uc_string32_hex_dec[(uint8_t) pc_src[0] & 0x7F];
+    uint8_t uc_low = uc_string32_hex_dec[(uint8_t) pc_src[1] & 0x7F];
+
+    if ((((uint8_t) pc_src[0] | (uint8_t) pc_src[1] | uc_high | uc_low) & 0x80U) != 0U) {
+      return STRING32_CODEC_ERROR;
+    }
+
+    *puc_dst = (uint8_t) ((uc_high << 4) | uc_low);
+
+    pc_src += 2;
+    ++puc_dst;
+    x_len -= 2;
+  }
+
+  return (size_t) (puc_dst - (uint8_t*) pv_dst);
+}
+
+/*
+ * @brief Encode block of memory to Base64 with padding (RFC 4648)
+ * @param *pc_dst - Destination, at least STRING32_B64ENC_LEN(x_len) chars
+ * @param *pv_src - Pointer to the data to be encoded
+ * @param x_len - Number of bytes to encode
+ * @note Terminator is not added
+ * @retval number of chars written
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+size_t b64enc32(char* pc_dst, void const* pv_src, size_t x_len)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if ((pc_dst == NULL) || (pv_src == NULL)) {
+    return 0UL;
+  }
+#endif
+
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+  char* pc_out = pc_dst;
+
+  // Three bytes of source give word of chars
+  while (x_len >= 3UL) {
+    uint32_t ul_val = ((uint32_t) puc_src[0] << 16) | ((uint32_t) puc_src[1] << 8) | puc_src[2];
+
+    string32_store_le32(pc_out, (uint32_t) (uint8_t) c_string32_b64_enc[ul_val >> 18]
+                                | ((uint32_t) (uint8_t) c_string32_b64_enc[(ul_val >> 12) & 0x3F] << 8)
+                                | ((uint32_t) (uint8_t) c_string32_b64_enc[(ul_val >> 6) & 0x3F] << 16)
+                                | ((uint32_t) (uint8_t) c_string32_b64_enc[ul_val & 0x3F] << 24));
+
+    puc_src += 3;
+    pc_out += sizeof(uint32_t);
+    x_len -= 3UL;
+  }
+
+  if (x_len != 0UL) {
+    uint32_t ul_val = (uint32_t) puc_src[0] << 16;
+
+    if (x_len == 2UL) {
+      ul_val |= (uint32_t) puc_src[1] << 8;
+    }
+
+    pc_out[0] = c_string32_b64_enc[ul_val >> 18];
+    pc_out[1] = c_string32_b64_enc[(ul_val >> 12) & 0x3F];
+    pc_out[2] = (x_len == 2UL) ? c_string32_b64_enc[(ul_val >> 6) & 0x3F] : '=';
+    pc_out[3] = '=';
+
+    pc_out += sizeof(uint32_t);
+  }
+
+  return (size_t) (pc_out - pc_dst);
+}
+
+/*
+ * @brief Decode Base64 with padding (RFC 4648) to block of memory
+ * @param *pv_dst - Destination, at least STRING32_B64DEC_LEN(x_len) bytes
+ * @param *pc_src - Base64 chars
+ * @param x_len - Number of chars to decode, multiple of 4
+ * @note Never reads outside of x_len chars. Padding is allowed only at the end.
+ *       Destination may be partly written if input is invalid.
+ * @retval number of bytes written, or STRING32_CODEC_ERROR for invalid input
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+size_t b64dec32(void* pv_dst, const char* pc_src, size_t x_len)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if ((pv_dst == NULL) || (pc_src == NULL)) {
+    return STRING32_CODEC_ERROR;
+  }
+#endif
+
+  if ((x_len & 3UL) != 0UL) {
+    return STRING32_CODEC_ERROR;
+  }
+
+  uint8_t* puc_dst = (uint8_t*) pv_dst;
+
+  while (x_len != 0UL) {
+    uint32_t ul_chars = string32_load_le32(pc_src);
+    size_t x_out = 3UL;
+
+    // Only last quantum may have padding: "xx==" or "xxx="
+    if (x_len == sizeof(uint32_t)) {
+      if ((ul_chars >> 24) == '=') {
+        x_out = (((ul_chars >> 16) & 0xFF) == '=') ? 1UL : 2UL;
+        ul_chars &= (x_out == 1UL) ? 0x0000FFFFUL : 0x00FFFFFFUL;
+        ul_chars |= (x_out == 1UL) ? 0x41410000UL : 0x41000000UL;  // decode padding as 'A'
+      }
+    }
+
+    if ((ul_chars & 0x80808080UL) != 0UL) {
+      return STRING32_CODEC_ERROR;
+    }
+
+    uint8_t uc_d0 = uc_string32_b64_dec[ul_chars & 0x7F];
+    uint8_t uc_d1 = uc_string32_b64_dec[(ul_chars >> 8) & 0x7F];
+    uint8_t uc_d2 = uc_string32_b64_dec[(ul_chars >> 16) & 0x7F];
+    uint8_t uc_d3 = uc_string32_b64_dec[ul_chars >> 24];
+
+    // All invalid chars are found by one test
+    if (((uc_d0 | uc_d1 | uc_d2 | uc_d3) & 0x80U) != 0U) {
+      return STRING32_CODEC_ERROR;
+    }
+
+    uint32_t ul_val = ((uint32_t) uc_d0 << 18) | ((uint32_t) uc_d1 << 12)
+                      | ((uint32_t) uc_d2 << 6) | uc_d3;
+
+    puc_dst[0] = (uint8_t) (ul_val >> 16);
+
+    if (x_out > 1UL) {
+      puc_dst[1] = (uint8_t) (ul_val >> 8);
+    }
+
+    if (x_out > 2UL) {
+      puc_dst[2] = (uint8_t) ul_val;
+    }
+
+    pc_src += sizeof(uint32_t);
+    puc_dst += x_out;
+    x_len -= sizeof(uint32_t);
+  }
+
+  return (size_t) (puc_dst - (uint8_t*) pv_dst);
+}
+
+/* ===================== Matcher ===================== */
+
+/*
+ * @brief Lowercase ASCII letters of word, other bytes are untouched
+ */
+static inline uint32_t string32_lower_word(uint32_t ul_word)
+{
+  uint32_t ul_heptets = ul_word & 0x7F7F7F7FUL;
+  uint32_t ul_above_z = ul_heptets + 0x25252525UL;  // high bit set if byte > 'Z'
+  uint32_t ul_from_a = ul_heptets + 0x3F3F3F3FUL;   // high bit set if byte >= 'A'
+  uint32_t ul_upper = ~ul_word & ~ul_above_z & ul_from_a & 0x80808080UL;
+
+  return ul_word | (ul_upper >> 2);
+}
+
+/*
+ * @brief Pack first chars of string into word, zero padded
+ * @note Never reads more than x_len chars
+ */
+static inline uint32_t string32_match_head(const char* pc_str, size_t x_len, uint32_t ul_flags)
+{
+  uint32_t ul_head = 0UL;
+
+  if (x_len >= sizeof(uint32_t)) {
+    ul_head = string32_load_le32(pc_str);
+  } else {
+    for (size_t x_i = 0UL; x_i < x_len; x_i++) {
+      ul_head |= (uint32_t) (uint8_t) pc_str[x_i] << (x_i * 8UL);
+    }
+  }
+
+  return ((ul_flags & STRING32_MATCH_NOCASE) != 0UL) ? string32_lower_word(ul_head) : ul_head;
+}
+
+/*
+ * @brief Compare blocks of chars, ASCII case is ignored with STRING32_MATCH_NOCASE
+ * @note Words are loaded by string32_load_le32(), so any alignment is fine
+ * @retval true if blocks are equal
+ */
+static bool string32_match_equal(const char* pc_str1, const char* pc_str2, size_t x_len, uint32_t ul_flags)
+{
+  bool b_nocase = ((ul_flags & STRING32_MATCH_NOCASE) != 0UL);
+
+  while (x_len >= sizeof(uint32_t)) {
+    uint32_t ul_word1 = string32_load_le32(pc_str1);
+    uint32_t ul_word2 = string32_load_le32(pc_str2);
+
+    if (b_nocase) {
+      ul_word1 = string32_lower_word(ul_word1);
+      ul_word2 = string32_lower_word(ul_word2);
+    }
+
+    if (ul_word1 != ul_word2) {
+      return false;
+    }
+
+    pc_str1 += sizeof(uint32_t);
+    pc_str2 += sizeof(uint32_t);
+    x_len -= sizeof(uint32_t);
+  }
+
+  return string32_match_head(pc_str1, x_len, ul_flags) == string32_match_head(pc_str2, x_len, ul_flags);
+}
+
+/*
+ * @brief Check rest of keyword after head
+ */
+static bool string32_match_tail(string32_matcher_t const* px_matcher,
+                                string32_match_entry_t const* px_entry, const char* pc_input)
+{
+  if (px_entry->us_len <= sizeof(uint32_t)) {
+    return true;
+  }
+
+  const char* pc_key = px_matcher->ppc_keys[px_entry->us_index];
+
+  return string32_match_equal(pc_key + sizeof(uint32_t), pc_input + sizeof(uint32_t),
+                              px_entry->us_len - sizeof(uint32_t), px_matcher->ul_flags);
+}
+
+/*
+ * @brief Check that keyword of x_key_len chars ends at word boundary of input
+ * @note Without STRING32_MATCH_WORD any end is fine
+ */
+static bool string32_match_boundary(uint32_t ul_flags, const char* pc_input, size_t x_len, size_t x_key_len)
+{
+  if (((ul_flags & STRING32_MATCH_WORD) == 0UL) || (x_key_len == x_len)) {
+    return true;
+  }
+
+  uint8_t uc_sym = (uint8_t) pc_input[x_key_len];
+
+  return !(((uc_sym >= '0') && (uc_sym <= '9')) || (((uc_sym | 0x20) >= 'a') && ((uc_sym | 0x20) <= 'z'))
+           || (uc_sym == '_'));
+}
+
+/*
+ * @brief Find first entry not less than (head, length)
+ */
+static uint32_t string32_match_lower_bound(string32_matcher_t const* px_matcher,
+                                           uint32_t ul_head, size_t x_len)
+{
+  uint32_t ul_low = 0UL;
+  uint32_t ul_high = px_matcher->ul_count;
+
+  while (ul_low < ul_high) {
+    uint32_t ul_mid = ul_low + ((ul_high - ul_low) / 2UL);
+    string32_match_entry_t const* px_entry = &px_matcher->px_entries[ul_mid];
+
+    if ((px_entry->ul_head < ul_head) || ((px_entry->ul_head == ul_head) && (px_entry->us_len < x_len))) {
+      ul_low = ul_mid + 1UL;
+    } else {
+      ul_high = ul_mid;
+    }
+  }
+
+  return ul_low;
+}
+
+/*
+ * @brief Compile table of keywords into matcher
+ * @param *px_matcher - Matcher to initialise
+ * @param **ppc_keys - Table of keywords, must live as long as matcher
+ * @param ul_count - Number of keywords
+ * @param *px_entries - Storage for ul_count entries, must live as long as matcher
+ * @param ul_flags - STRING32_MATCH_PREFIX or STRING32_MATCH_WORD, and/or STRING32_MATCH_NOCASE
+ * @note Keywords are sorted by their first word and length,
+ *       so every lookup is a binary search and single tail compare
+ * @retval true on success, false if there is empty or too long keyword
+ */
+bool string32_matcher_init(string32_matcher_t* px_matcher, const char* const* ppc_keys, uint32_t ul_count,
+                           string32_match_entry_t* px_entries, uint32_t ul_flags)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if ((px_matcher == NULL) || (ppc_keys == NULL) || (px_entries == NULL)) {
+    return false;
+  }
+#endif
+
+  if (ul_count > 0xFFFFUL) {
+    return false;
+  }
+
+  for (uint32_t ul_i = 0UL; ul_i < ul_count; ul_i++) {
+    size_t x_len = strlen32(ppc_keys[ul_i]);
+
+    if ((x_len == 0UL) || (x_len > 0xFFFFUL)) {
+      return false;
+    }
+
+    string32_match_entry_t x_entry;
+
+    x_entry.ul_head = string32_match_head(ppc_keys[ul_i], x_len, ul_flags);
+    x_entry.us_index = (uint16_t) ul_i;
+    x_entry.us_len = (uint16_t) x_len;
+
+    // Insertion sort, it is done only once
+    uint32_t ul_pos = ul_i;
+
+    while ((ul_pos > 0UL)
+           && ((px_entries[ul_pos - 1UL].ul_head > x_entry.ul_head)
+               || ((px_entries[ul_pos - 1UL].ul_head == x_entry.ul_head)
+                   && (px_entries[ul_pos - 1UL].us_len > x_entry.us_len)))) {
+      px_entries[ul_pos] = px_entries[ul_pos - 1UL];
+      --ul_pos;
+    }
+
+    px_entries[ul_pos] = x_entry;
+  }
+
+  px_matcher->ppc_keys = ppc_keys;
+  px_matcher->px_entries = px_entries;
+  px_matcher->ul_count = ul_count;
+  px_matcher->ul_flags = ul_flags;
+
+  return true;
+}
+
+/*
+ * @brief Find keyword for input
+ * @param *px_matcher - Compiled matcher
+ * @param *pc_input - Input chars, terminator is not needed
+ * @param x_len - Number of input chars
+ * @note In STRING32_MATCH_PREFIX mode keyword must be at start of input
+ *       and the longest one wins, order of keywords table doesn't matter.
+ *       STRING32_MATCH_WORD is the same, but keyword must be followed by
+ *       end of input or by char other than letter, digit or '_'.
+ *       Otherwise whole input must be equal to keyword
+ * @retval index of keyword in table, or STRING32_MATCH_NONE
+ */
+int32_t string32_match(string32_matcher_t const* px_matcher, const char* pc_input, size_t x_len)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if ((px_matcher == NULL) || (pc_input == NULL)) {
+    return STRING32_MATCH_NONE;
+  }
+#endif
+
+  uint32_t ul_flags = px_matcher->ul_flags;
+  string32_match_entry_t const* px_entries = px_matcher->px_entries;
+
+  if ((ul_flags & (STRING32_MATCH_PREFIX | STRING32_MATCH_WORD)) == 0UL) {
+    uint32_t ul_head = string32_match_head(pc_input, x_len, ul_flags);
+
+    for (uint32_t ul_i = string32_match_lower_bound(px_matcher, ul_head, x_len);
+         (ul_i < px_matcher->ul_count) && (px_entries[ul_i].ul_head == ul_head)
+         && (px_entries[ul_i].us_len == x_len); ul_i++) {
+      if (string32_match_tail(px_matcher, &px_entries[ul_i], pc_input)) {
+        return (int32_t) px_entries[ul_i].us_index;
+      }
+    }
+
+    return STRING32_MATCH_NONE;
+  }
+
+  // Keywords of 4 chars and longer share full head with input
+  if (x_len >= sizeof(uint32_t)) {
+    uint32_t ul_head = string32_match_head(pc_input, sizeof(uint32_t), ul_flags);
+    int32_t l_found = STRING32_MATCH_NONE;
+
+    // Entries are sorted by length, so the last match is the longest one
+    for (uint32_t ul_i = string32_match_lower_bound(px_matcher, ul_head, sizeof(uint32_t));
+         (ul_i < px_matcher->ul_count) && (px_entries[ul_i].ul_head == ul_head)
+         && (px_entries[ul_i].us_len <= x_len); ul_i++) {
+      if (string32_match_tail(px_matcher, &px_entries[ul_i], pc_input)
+          && string32_match_boundary(ul_flags, pc_input, x_len, px_entries[ul_i].us_len)) {
+        l_found = (int32_t) px_entries[ul_i].us_index;
+      }
+    }
+
+    if (l_found != STRING32_MATCH_NONE) {
+      return l_found;
+    }
+  }
+
+  // Shorter keywords are equal to masked head of input
+  for (size_t x_key_len = (x_len < sizeof(uint32_t)) ? x_len : (sizeof(uint32_t) - 1UL);
+       x_key_len > 0UL; x_key_len--) {
+    uint32_t ul_head = string32_match_head(pc_input, x_key_len, ul_flags);
+    uint32_t ul_i = string32_match_lower_bound(px_matcher, ul_head, x_key_len);
+
+    if ((ul_i < px_matcher->ul_count) && (px_entries[ul_i].ul_head == ul_head)
+        && (px_entries[ul_i].us_len == x_key_len)
+        && string32_match_boundary(ul_flags, pc_input, x_len, x_key_len)) {
+      return (int32_t) px_entries[ul_i].us_index;
+    }
+  }
+
+  return STRING32_MATCH_NONE;
+}
+
+/* ===================== Hashing ===================== */
+
+// MurmurHash3 (x86_32) constants
+#define STRING32_HASH_C1  0xCC9E2D51UL
+#define STRING32_HASH_C2  0x1B873593UL
+
+static inline uint32_t string32_rotl(uint32_t ul_val, uint32_t ul_bits)
+{
+  return (ul_val << ul_bits) | (ul_val >> (32UL - ul_bits));
+}
+
+static inline uint32_t string32_hash_block(uint32_t ul_hash, uint32_t ul_block)
+{
+  ul_block *= STRING32_HASH_C1;
+  ul_block = string32_rotl(ul_block, 15UL);
+  ul_block *= STRING32_HASH_C2;
+
+  ul_hash ^= ul_block;
+  ul_hash = string32_rotl(ul_hash, 13UL);
+
+  return ul_hash * 5UL + 0xE6546B64UL;
+}
+
+// Same zero byte test as in word kernels, but for little endian loaded words
+static inline uint32_t string32_zero_le32(uint32_t ul_word)
+{
+  return (ul_word - 0x01010101UL) & ~ul_word & 0x80808080UL;
+}
+
+// Lowest marked byte is always a real zero
+static inline uint32_t string32_zero_index_le32(uint32_t ul_word)
+{
+  uint32_t ul_zero = string32_zero_le32(ul_word);
+
+#ifdef __GNUC__
+  return (uint32_t) __builtin_ctz(ul_zero) / 8UL;
+#else
+  uint32_t ul_index = 0UL;
+
+  while (((ul_zero >> (ul_index * 8UL)) & 0x80UL) == 0UL) {
+    ul_index++;
+  }
+
+  return ul_index;
+#endif
+}
+
+static inline uint32_t string32_hash_final(uint32_t ul_hash, uint32_t ul_tail, size_t x_len)
+{
+  if ((x_len & 3UL) != 0UL) {
+    ul_tail *= STRING32_HASH_C1;
+    ul_tail = string32_rotl(ul_tail, 15UL);
+    ul_tail *= STRING32_HASH_C2;
+    ul_hash ^= ul_tail;
+  }
+
+  ul_hash ^= (uint32_t) x_len;
+
+  // Avalanche
+  ul_hash ^= ul_hash >> 16;
+  ul_hash *= 0x85EBCA6BUL;
+  ul_hash ^= ul_hash >> 13;
+  ul_hash *= 0xC2B2AE35UL;
+  ul_hash ^= ul_hash >> 16;
+
+  return ul_hash;
+}
+
+/*
+ * @brief Hash block of memory with seed
+ * @param *pv_src - Pointer to the data to be hashed
+ * @param x_len - Number of bytes to hash
+ * @param ul_seed - Seed, random secret one makes collisions hard to precompute
+ * @note Same as MurmurHash3_x86_32, result doesn't depend on endianness
+ * @retval 32bit hash
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+uint32_t memhash32_seed(void const* pv_src, size_t x_len, uint32_t ul_seed)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if (pv_src == NULL) {
+    return 0UL;
+  }
+#endif
+
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+  uint32_t ul_hash = ul_seed;
+
+  for (size_t x_left = x_len; x_left >= sizeof(uint32_t); x_left -= sizeof(uint32_t)) {
+    ul_hash = string32_hash_block(ul_hash, string32_load_le32(puc_src));
+    puc_src += sizeof(uint32_t);
+  }
+
+  uint32_t ul_tail = 0UL;
+
+  for (size_t x_i = 0UL; x_i < (x_len & 3UL); x_i++) {
+    ul_tail |= (uint32_t) puc_src[x_i] << (x_i * 8UL);
+  }
+
+  return string32_hash_final(ul_hash, ul_tail, x_len);
+}
+
+/*
+ * @brief Hash block of memory
+ * @retval 32bit hash, the same as memhash32_seed() with zero seed
+ */
+uint32_t memhash32(void const* pv_src, size_t x_len)
+{
+  return memhash32_seed(pv_src, x_len, 0UL);
+}
+
+/*
+ * @brief Hash C string with seed, terminator is found in the same pass
+ * @param *pv_src - C string
+ * @param ul_seed - Seed, random secret one makes collisions hard to precompute
+ * @param *px_len - Where to put length of string, may be NULL
+ * @note Result is equal to memhash32_seed(pv_src, strlen32(pv_src), ul_seed).
+ *       Words are read only from aligned addresses, so it never reads
+ *       outside of aligned word which hold terminator.
+ * @retval 32bit hash
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+uint32_t strhash32_seed(void const* pv_src, uint32_t ul_seed, size_t* px_len)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if (pv_src == NULL) {
+    if (px_len != NULL) {
+      *px_len = 0UL;
+    }
+
+    return 0UL;
+  }
+#endif
+
+  uint32_t ul_skip = (uint32_t) ((uintptr_t) pv_src & (sizeof(uint32_t) - 1UL));
+  uint32_t const* pul_src = (uint32_t const*) ((uint8_t const*) pv_src - ul_skip);
+  uint32_t ul_hash = ul_seed;
+  uint32_t ul_tail = 0UL;
+  uint32_t ul_tail_len = 0UL;
+  size_t x_len = 0UL;
+
+  if (ul_skip == 0UL) {
+    for (;;) {
+      uint32_t ul_word = string32_load_le32(pul_src++);
+
+      if (string32_zero_le32(ul_word) != 0UL) {
+        ul_tail_len = string32_zero_index_le32(ul_word);
+        ul_tail = ul_word;
+        break;
+      }
+
+      ul_hash = string32_hash_block(ul_hash, ul_word);
+      x_len += sizeof(uint32_t);
+    }
+  } else {
+    uint32_t ul_shift = ul_skip * 8UL;
+
+    // Bytes before string must not look like terminator
+    uint32_t ul_word = string32_load_le32(pul_src++) | (0xFFFFFFFFUL >> (32UL - ul_shift));
+    uint32_t ul_low = ul_word >> ul_shift;
+
+    if (string32_zero_le32(ul_word) != 0UL) {
+      ul_tail_len = string32_zero_index_le32(ul_word) - ul_skip;
+      ul_tail = ul_low;
+    } else {
+      // Each block is upper part of one aligned word and lower part of next one
+      for (;;) {
+        ul_word = string32_load_le32(pul_src++);
+
+        uint32_t ul_block = ul_low | (ul_word << (32UL - ul_shift));
+
+        if (string32_zero_le32(ul_word) != 0UL) {
+          uint32_t ul_index = string32_zero_index_le32(ul_word);
+
+          if (ul_index < ul_skip) {
+            ul_tail_len = sizeof(uint32_t) - ul_skip + ul_index;
+            ul_tail = ul_block;
+          } else {
+            ul_hash = string32_hash_block(ul_hash, ul_block);
+            x_len += sizeof(uint32_t);
+            ul_tail_len = ul_index - ul_skip;
+            ul_tail = ul_word >> ul_shift;
+          }
+          break;
+        }
+
+        ul_hash = string32_hash_block(ul_hash, ul_block);
+        x_len += sizeof(uint32_t);
+        ul_low = ul_word >> ul_shift;
+      }
+    }
+  }
+
+  // Drop terminator and bytes after it
+  ul_tail &= (ul_tail_len == 0UL) ? 0UL : (0xFFFFFFFFUL >> (32UL - ul_tail_len * 8UL));
+  x_len += ul_tail_len;
+
+  if (px_len != NULL) {
+    *px_len = x_len;
+  }
+
+  return string32_hash_final(ul_hash, ul_tail, x_len);
+}
+
+/*
+ * @brief Hash C string
+ * @retval 32bit hash, the same as memhash32() of the string
+ */
+uint32_t strhash32(void const* pv_src)
+{
+  return strhash32_seed(pv_src, 0UL, NULL);
+}
+
+/* ==================== Other ======================== */
+// memset32() and strlen32() are made from string32_word.h
+
+/* ==================== Startup ====================== */
+
+/*
+ * @brief Copy .data and zero .bss sections from Reset_Handler
+ * @param *px_copy_start - First entry of copy table, e.g. __copy_table_start__
+ * @param *px_copy_end - End of copy table, e.g. __copy_table_end__
+ * @param *px_zero_start - First entry of zero table, e.g. __zero_table_start__
+ * @param *px_zero_end - End of zero table, e.g. __zero_table_end__
+ * @note Runs before C runtime init, so it never touch any global data,
+ *       profiling or dispatch table. Regions are word aligned and
+ *       counted in words, so eight words are moved per step,
+ *       what becomes LDM/STM bursts on Cortex-M, and single words after that.
+ *       Tables are made by linker script, like in CMSIS gcc_arm.ld:
+ *         __copy_table_start__ = .;
+ *         LONG (LOADADDR(.data))
+ *         LONG (ADDR(.data))
+ *         LONG (SIZEOF(.data) / 4)
+ *         __copy_table_end__ = .;
+ * @retval none
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+void string32_init_sections(const string32_copy_region_t* px_copy_start,
+                            const string32_copy_region_t* px_copy_end,
+                            const string32_zero_region_t* px_zero_start,
+                            const string32_zero_region_t* px_zero_end)
+{
+  for (; px_copy_start < px_copy_end; ++px_copy_start) {
+    uint32_t const* pul_src = px_copy_start->pul_src;
+    uint32_t* pul_dst = px_copy_start->pul_dst;
+    uint32_t ul_wlen = px_copy_start->ul_wlen;
+
+    // All loads before stores, so they can be merged into one LDM and one STM
+    while (ul_wlen >= 8UL) {
+      uint32_t ul_w0 = pul_src[0];
+      uint32_t ul_w1 = pul_src[1];
+      uint32_t ul_w2 = pul_src[2];
+      uint32_t ul_w3 = pul_src[3];
+      uint32_t ul_w4 = pul_src[4];
+      uint32_t ul_w5 = pul_src[5];
+      uint32_t ul_w6 = pul_src[6];
+      uint32_t ul_w7 = pul_src[7];
+
+      pul_dst[0] = ul_w0;
+      pul_dst[1] = ul_w1;
+      pul_dst[2] = ul_w2;
+      pul_dst[3] = ul_w3;
+      pul_dst[4] = ul_w4;
+      pul_dst[5] = ul_w5;
+      pul_dst[6] = ul_w6;
+      pul_dst[7] = ul_w7;
+
+      pul_src += 8;
+      pul_dst += 8;
+      ul_wlen -= 8UL;
+    }
+
+    while (ul_wlen--) {
+      *pul_dst = *pul_src;
+
+      ++pul_dst;
+      ++pul_src;
+    }
+  }
+
+  for (; px_zero_start < px_zero_end; ++px_zero_start) {
+    uint32_t* pul_dst = px_zero_start->pul_dst;
+    uint32_t ul_wlen = px_zero_start->ul_wlen;
+
+    while (ul_wlen >= 8UL) {
+      pul_dst[0] = 0UL;
+      pul_dst[1] = 0UL;
+      pul_dst[2] = 0UL;
+      pul_dst[3] = 0UL;
+      pul_dst[4] = 0UL;
+      pul_dst[5] = 0UL;
+      pul_dst[6] = 0UL;
+      pul_dst[7] = 0UL;
+
+      pul_dst += 8;
+      ul_wlen -= 8UL;
+    }
+
+    while (ul_wlen--) {
+      *pul_dst = 0UL;
+      ++pul_dst;
+    }
+  }
+}
+
+/* =================== Profiling ===================== */
+
+#ifdef _STRING32_LIB_PROFILE
+static string32_profile_t x_string32_profile[STRING32_PROFILE_TOTAL];
+
+static const char* const pc_string32_profile_names[STRING32_PROFILE_TOTAL] = {
+  "memcpy32",
+  "memcmp32",
+  "memset32",
+  "strlen32",
+};
+
+#ifdef _STRING32_LIB_PROFILE_CLOCK
+#define _STRING32_PROFILE_ENTER()  uint32_t ul_profile_clock = _STRING32_LIB_PROFILE_CLOCK()
+#define _STRING32_PROFILE_CLOCKS() ((uint32_t) (_STRING32_LIB_PROFILE_CLOCK() - ul_profile_clock))
+#else
+#define _STRING32_PROFILE_ENTER()
+#define _STRING32_PROFILE_CLOCKS() 0UL
+#endif // _STRING32_LIB_PROFILE_CLOCK
+
+#define _STRING32_PROFILE_LEAVE(e_func, pv_dst, pv_src, x_len) \
+  string32_profile_record((e_func), (pv_dst), (pv_src), (x_len), _STRING32_PROFILE_CLOCKS())
+
+static string32_profile_hook_t pf_string32_profile_hook;
+static bool b_string32_profile_in_hook;
+
+/*
+ * @brief Put single call into profile table and pass it to hook
+ * @note Not reentrant, calls from interrupts may be lost.
+ *       Calls made by hook itself are not recorded.
+ */
+static void string32_profile_record(string32_profile_func_t e_func, void const* pv_dst,
+                                    void const* pv_src, size_t x_len, uint32_t ul_clocks)
+{
+  if (b_string32_profile_in_hook) {
+    return;
+  }
+
+  string32_profile_t* px_profile = &x_string32_profile[e_func];
+  uint32_t ul_bucket = 0UL;
+
+  // Bucket is the number of significant bits in size,
+  // so bucket N hold sizes from 2^(N-1) to 2^N - 1
+#ifdef __GNUC__
+  if (x_len != 0UL) {
+    ul_bucket = 64UL - (uint32_t) __builtin_clzll((unsigned long long) x_len);
+  }
+#else
+  for (size_t x_tmp = x_len; x_tmp != 0UL; x_tmp >>= 1) {
+    ++ul_bucket;
+  }
+#endif
+
+  ++px_profile->ul_calls;
+  ++px_profile->ul_size_hist[ul_bucket];
+  ++px_profile->ul_align_hist[(uintptr_t) pv_dst & (STRING32_PROFILE_ALIGN_CLASSES - 1)]
+                             [(uintptr_t) pv_src & (STRING32_PROFILE_ALIGN_CLASSES - 1)];
+  px_profile->ull_clocks += ul_clocks;
+
+  if (pf_string32_profile_hook != NULL) {
+    string32_profile_call_t x_call;
+
+    x_call.e_func = e_func;
+    x_call.pv_dst = pv_dst;
+    x_call.pv_src = pv_src;
+    x_call.x_len = x_len;
+    x_call.ul_clocks = ul_clocks;
+
+    b_string32_profile_in_hook = true;
+    pf_string32_profile_hook(&x_call);
+    b_string32_profile_in_hook = false;
+  }
+}
+
+static void string32_profile_puts(void (*pf_putc)(char c_sym), const char* pc_str)
+{
+  while (*pc_str != '\0') {
+    pf_putc(*pc_str);
+    ++pc_str;
+  }
+}
+
+static void string32_profile_putu(void (*pf_putc)(char c_sym), uint64_t ull_val)
+{
+  char c_buff[20];
+  uint32_t ul_pos = 0UL;
+
+  do {
+    c_buff[ul_pos++] = (char) ('0' + (ull_val % 10U));
+    ull_val /= 10U;
+  } while (ull_val != 0ULL);
+
+  while (ul_pos--) {
+    pf_putc(c_buff[ul_pos]);
+  }
+}
+#else
+#define _STRING32_PROFILE_ENTER()
+#define _STRING32_PROFILE_LEAVE(e_func, pv_dst, pv_src, x_len)
+#endif // _STRING32_LIB_PROFILE
+
+/*
+ * @brief Get collected profile of one function
+ * @param e_func - Function to get profile for
+ * @retval pointer to profile, or NULL if _STRING32_LIB_PROFILE is not enabled
+ */
+const string32_profile_t* string32_profile_get(string32_profile_func_t e_func)
+{
+#ifdef _STRING32_LIB_PROFILE
+  if (e_func < STRING32_PROFILE_TOTAL) {
+    return &x_string32_profile[e_func];
+  }
+#else
+  (void) e_func;
+#endif
+
+  return NULL;
+}
+
+/*
+ * @brief Set function to be called after every profiled call
+ * @param pf_hook - Hook, e.g. to record trace for benchmarks/replay, or NULL to remove it
+ * @note Does nothing if _STRING32_LIB_PROFILE is not enabled
+ * @retval none
+ */
+void string32_profile_set_hook(string32_profile_hook_t pf_hook)
+{
+#ifdef _STRING32_LIB_PROFILE
+  pf_string32_profile_hook = pf_hook;
+#else
+  (void) pf_hook;
+#endif
+}
+
+/*
+ * @brief Clear all collected profiles
+ * @retval none
+ */
+void string32_profile_reset(void)
+{
+#ifdef _STRING32_LIB_PROFILE
+  // Kernel is called directly, so this call is not profiled itself
+  _STRING32_KERNEL(memset32)(&x_string32_profile[0], 0UL, sizeof(x_string32_profile));
+#endif
+}
+
+/*
+ * @brief Print all collected profiles as text
+ * @param pf_putc - Function to put single char into UART, semihosting, etc.
+ * @note Only non empty histogram entries are printed
+ * @retval none
+ */
+void string32_profile_dump(void (*pf_putc)(char c_sym))
+{
+#ifdef _STRING32_LIB_PROFILE
+  for (uint32_t ul_func = 0UL; ul_func < STRING32_PROFILE_TOTAL; ul_func++) {
+    string32_profile_t const* px_profile = &x_string32_profile[ul_func];
+
+    string32_profile_puts(pf_putc, pc_string32_profile_names[ul_func]);
+    string32_profile_puts(pf_putc, ": calls ");
+    string32_profile_putu(pf_putc, px_profile->ul_calls);
+    string32_profile_puts(pf_putc, ", clocks ");
+    string32_profile_putu(pf_putc, px_profile->ull_clocks);
+    pf_putc('\n');
+
+    for (uint32_t ul_bucket = 0UL; ul_bucket < STRING32_PROFILE_SIZE_BUCKETS; ul_bucket++) {
+      if (px_profile->ul_size_hist[ul_bucket] == 0UL) {
+        continue;
+      }
+
+      size_t x_low = (ul_bucket == 0UL) ? 0UL : ((size_t) 1UL << (ul_bucket - 1UL));
+
+      string32_profile_puts(pf_putc, "  len ");
+      string32_profile_putu(pf_putc, x_low);
+      string32_profile_puts(pf_putc, "..");
+      string32_profile_putu(pf_putc, (x_low == 0UL) ? 0UL : (x_low + (x_low - 1UL)));
+      string32_profile_puts(pf_putc, ": ");
+      string32_profile_putu(pf_putc, px_profile->ul_size_hist[ul_bucket]);
+      pf_putc('\n');
+    }
+
+    for (uint32_t ul_dst = 0UL; ul_dst < STRING32_PROFILE_ALIGN_CLASSES; ul_dst++) {
+      for (uint32_t ul_src = 0UL; ul_src < STRING32_PROFILE_ALIGN_CLASSES; ul_src++) {
+        if (px_profile->ul_align_hist[ul_dst][ul_src] == 0UL) {
+          continue;
+        }
+
+        string32_profile_puts(pf_putc, "  align dst+");
+        string32_profile_putu(pf_putc, ul_dst);
+        string32_profile_puts(pf_putc, " src+");
+        string32_profile_putu(pf_putc, ul_src);
+        string32_profile_puts(pf_putc, ": ");
+        string32_profile_putu(pf_putc, px_profile->ul_align_hist[ul_dst][ul_src]);
+        pf_putc('\n');
+      }
+    }
+  }
+#else
+  (void) pf_putc;
+#endif
+}
+
+/* ================= Aligned kernels ================= */
+// Used by dispatcher on cores without unaligned access and by standard names
+
+#ifdef _STRING32_LIB_ALIGNED_KERNELS
+
+/*
+ * @brief Copy block of memory without unaligned word access
+ * @note For cores which can't do it (Cortex-M0/M0+/M23),
+ *       or have unaligned access trap enabled
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+static void* memcpy32_aligned(void* pv_dst, void const* pv_src, size_t x_len)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if ((pv_dst == NULL) || (pv_src == NULL)) {
+    return NULL;
+  }
+#endif
+
+  uint8_t* puc_dst = (uint8_t*) pv_dst;
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+
+  // Word copy is possible only when both pointers have same misalignment
+  if ((((uintptr_t) puc_dst ^ (uintptr_t) puc_src) & (sizeof(uint32_t) - 1)) == 0UL) {
+    while ((x_len != 0UL) && !_STRING32_IS_ALIGNED(puc_dst)) {
+      *puc_dst = *puc_src;
+
+      ++puc_dst;
+      ++puc_src;
+      --x_len;
+    }
+
+    uint32_t* pul_dst = (uint32_t*) puc_dst;
+    uint32_t const* pul_src = (uint32_t const*) puc_src;
+
+    while (x_len >= sizeof(uint32_t)) {
+      *pul_dst = *pul_src;
+
+      ++pul_dst;
+      ++pul_src;
+      x_len -= sizeof(uint32_t);
+    }
+
+    puc_dst = (uint8_t*) pul_dst;
+    puc_src = (uint8_t const*) pul_src;
+  }
+
+  while (x_len--) {
+    *puc_dst = *puc_src;
+
+    ++puc_dst;
+    ++puc_src;
+  }
+
+  return pv_dst;
+}
+
+/*
+ * @brief Compare two blocks of memory without unaligned word access
+ * @note Result is the same as for word kernel
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+static size_t memcmp32_aligned(void const* pv_ptr1, void const* pv_ptr2, size_t x_len)
+{
+  if (_STRING32_IS_ALIGNED(pv_ptr1) && _STRING32_IS_ALIGNED(pv_ptr2)) {
+    return _STRING32_KERNEL(memcmp32)(pv_ptr1, pv_ptr2, x_len);
+  }
+
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if ((pv_ptr1 == NULL) || (pv_ptr2 == NULL)) {
+    return 0UL;
+  }
+#endif
+
+  uint8_t const *puc_ptr1 = (uint8_t const *) pv_ptr1;
+  uint8_t const *puc_ptr2 = (uint8_t const *) pv_ptr2;
+  size_t x_res = 0L;
+
+  while (x_len--) {
+    if (*puc_ptr1 != *puc_ptr2) {
+      x_res = (*puc_ptr1 > *puc_ptr2) ? 1 : -1;
+      goto MEMCMP32_ALIGNED_DONE_END;
+    }
+
+    ++puc_ptr1;
+    ++puc_ptr2;
+  }
+
+  MEMCMP32_ALIGNED_DONE_END:
+  return x_res;
+}
+
+/*
+ * @brief Fill block of memory without unaligned word access
+ * @note Pattern is placed in memory exactly as word kernel place it
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+static void* memset32_aligned(void* pv_dst, uint32_t ul_val, size_t x_len)
+{
+  if (_STRING32_IS_ALIGNED(pv_dst)) {
+    return _STRING32_KERNEL(memset32)(pv_dst, ul_val, x_len);
+  }
+
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if (pv_dst == NULL) {
+    return NULL;
+  }
+#endif
+
+  uint8_t* puc_dst = (uint8_t*) pv_dst;
+
+  if (x_len > sizeof(uint32_t)) {
+    if (ul_val != 0) {
+      if (ul_val <= 0x000000FF) {
+        ul_val |= (ul_val << 8) | (ul_val << 16) | (ul_val << 24);
+      } else if ((ul_val & 0xFFFF0000) == 0UL) {
+        ul_val |= (ul_val << 16);
+      }
+    }
+
+    // Pattern twice in memory order, any 4 bytes from it is rotated pattern
+    uint32_t ul_pattern[2] = {ul_val, ul_val};
+    uint8_t const* puc_pattern = (uint8_t const*) &ul_pattern[0];
+    size_t x_pattern_len = x_len & ~(sizeof(uint32_t) - 1);
+    size_t x_phase = 0UL;
+
+    x_len -= x_pattern_len;
+
+    while (!_STRING32_IS_ALIGNED(puc_dst)) {
+      *puc_dst = puc_pattern[x_phase];
+
+      ++puc_dst;
+      ++x_phase;
+      --x_pattern_len;
+    }
+
+    uint32_t ul_rotated;
+    uint8_t* puc_rotated = (uint8_t*) &ul_rotated;
+
+    for (size_t x_i = 0UL; x_i < sizeof(uint32_t); x_i++) {
+      puc_rotated[x_i] = puc_pattern[x_phase + x_i];
+    }
+
+    uint32_t* pul_dst = (uint32_t*) puc_dst;
+
+    while (x_pattern_len >= sizeof(uint32_t)) {
+      *pul_dst = ul_rotated;
+      ++pul_dst;
+      x_pattern_len -= sizeof(uint32_t);
+    }
+
+    puc_dst = (uint8_t*) pul_dst;
+
+    for (size_t x_i = 0UL; x_i < x_pattern_len; x_i++) {
+      *puc_dst = puc_pattern[x_phase + x_i];
+      ++puc_dst;
+    }
+  }
+
+  while (x_len--) {
+    *puc_dst = (uint8_t) ul_val;
+    ++puc_dst;
+  }
+
+  return pv_dst;
+}
+
+/*
+ * @brief Get string length without unaligned word access
+ * @note Never read outside of aligned word which hold terminator,
+ *       so it can't cross page or memory region boundary
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+static size_t strlen32_aligned(void const* pv_src)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if (pv_src == NULL) {
+    return 0UL;
+  }
+#endif
+
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+
+  while (!_STRING32_IS_ALIGNED(puc_src)) {
+    if (*puc_src == '\0') {
+      return (size_t)(puc_src - (uint8_t const*) pv_src);
+    }
+
+    ++puc_src;
+  }
+
+  return (size_t)(puc_src - (uint8_t const*) pv_src) + _STRING32_KERNEL(strlen32)(puc_src);
+}
+#endif // _STRING32_LIB_ALIGNED_KERNELS
+
+/* ================== Dispatching ==================== */
+
+/*
+ * @brief Initialise library before first use
+ * @note Probes CPU capability once and binds kernels for public functions.
+ *       Does nothing when _STRING32_LIB_DISPATCH is not enabled,
+ *       or when kernels are already bound by GNU ifunc.
+ * @retval none
+ */
+#ifndef _STRING32_LIB_DISPATCH
+void string32_init(void)
+{
+}
+#else
+
+typedef struct {
+  void* (*pf_memcpy)(void* pv_dst, void const* pv_src, size_t x_len);
+  size_t (*pf_memcmp)(void const* pv_ptr1, void const* pv_ptr2, size_t x_len);
+  void* (*pf_memset)(void* pv_dst, uint32_t ul_val, size_t x_len);
+  size_t (*pf_strlen)(void const* pv_src);
+} string32_kernels_t;
+
+enum {
+  STRING32_KERNELS_WORD = 0,
+  STRING32_KERNELS_ALIGNED,
+#ifdef _STRING32_LIB_DISPATCH_WIDE
+  STRING32_KERNELS_WIDE,
+#endif
+};
+
+#ifdef _STRING32_LIB_DISPATCH_WIDE
+// Local names of 64bit kernels: address of local symbol is taken
+// relative to PC, without GOT, so ifunc resolvers can return it
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static void* memcpy64_local(void* pv_dst, void const* pv_src, size_t x_len) __attribute__ ((alias("memcpy64"), nothrow));
+static size_t memcmp64_local(void const* pv_ptr1, void const* pv_ptr2, size_t x_len) __attribute__ ((alias("memcmp64"), nothrow));
+static void* memset64_local(void* pv_dst, uint32_t ul_val, size_t x_len) __attribute__ ((alias("memset64"), nothrow));
+static size_t strlen64_local(void const* pv_src) __attribute__ ((alias("strlen64"), nothrow));
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+// System Control Block registers
+#define SCB_CPUID  (*(volatile uint32_t const*) 0xE000ED00)
+#define SCB_CCR    (*(volatile uint32_t const*) 0xE000ED14)
+
+#define SCB_CPUID_PARTNO(x_cpuid)  (((x_cpuid) >> 4) & 0x0FFFUL)
+#define SCB_CCR_UNALIGN_TRP        (1UL << 3)
+#endif
+
+/*
+ * @brief Find best kernels for current CPU
+ * @note Must be safe to call from GNU ifunc resolver, so it reads only
+ *       CPU registers and never touch any data which needs relocation
+ * @retval one of STRING32_KERNELS_*
+ */
+static uint32_t string32_probe(void)
+{
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+  uint32_t ul_cpuid = SCB_CPUID;
+
+  switch (SCB_CPUID_PARTNO(ul_cpuid)) {
+  case 0xC20:  // Cortex-M0
+  case 0xC60:  // Cortex-M0+
+  case 0xC21:  // Cortex-M1
+  case 0xD20:  // Cortex-M23
+    return STRING32_KERNELS_ALIGNED;
+
+  default:
+    break;
+  }
+
+  // Mainline core, but unaligned access will cause UsageFault
+  if ((SCB_CCR & SCB_CCR_UNALIGN_TRP) != 0UL) {
+    return STRING32_KERNELS_ALIGNED;
+  }
+#endif
+
+#ifdef _STRING32_LIB_DISPATCH_WIDE
+  // Every CPU of 64bit ABI has 64bit registers and unaligned load/store,
+  // so there is nothing else to probe on such hosts
+  return STRING32_KERNELS_WIDE;
+#endif
+
+  return STRING32_KERNELS_WORD;
+}
+
+#ifdef _STRING32_LIB_DISPATCH_IFUNC
+// Kernels are bound once by dynamic loader, so there is no per call cost.
+// Resolvers return addresses of local functions, as tables of pointers need relocation.
+// ifunc attribute takes symbol name, so resolvers must not be mangled in C++ build.
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef _STRING32_LIB_DISPATCH_WIDE
+#define _STRING32_RESOLVE_WIDE(x_name) \
+  case STRING32_KERNELS_WIDE: \
+    return x_name##64_local;
+#else
+#define _STRING32_RESOLVE_WIDE(x_name)
+#endif
+
+#define _STRING32_RESOLVE(x_name) \
+  switch (string32_probe()) { \
+  case STRING32_KERNELS_ALIGNED: \
+    return x_name##32_aligned; \
+  _STRING32_RESOLVE_WIDE(x_name) \
+  default: \
+    return x_name##32_word; \
+  }
+
+static void* (*memcpy32_resolve(void))(void*, void const*, size_t)
+{
+  _STRING32_RESOLVE(memcpy)
+}
+
+static size_t (*memcmp32_resolve(void))(void const*, void const*, size_t)
+{
+  _STRING32_RESOLVE(memcmp)
+}
+
+static void* (*memset32_resolve(void))(void*, uint32_t, size_t)
+{
+  _STRING32_RESOLVE(memset)
+}
+
+static size_t (*strlen32_resolve(void))(void const*)
+{
+  _STRING32_RESOLVE(strlen)
+}
+
+#undef _STRING32_RESOLVE
+#undef _STRING32_RESOLVE_WIDE
+
+#ifdef __cplusplus
+}
+#endif
+
+void* memcpy32(void* pv_dst, void const* pv_src, size_t x_len) __attribute__ ((ifunc("memcpy32_resolve")));
+size_t memcmp32(void const* pv_ptr1, void const* pv_ptr2, size_t x_len) __attribute__ ((ifunc("memcmp32_resolve")));
+void* memset32(void* pv_dst, uint32_t ul_val, size_t x_len) __attribute__ ((ifunc("memset32_resolve")));
+size_t strlen32(void const* pv_src) __attribute__ ((ifunc("strlen32_resolve")));
+
+void string32_init(void)
+{
+}
+#else
+// Same order as STRING32_KERNELS_* enum, without designators for C++ builds
+static const string32_kernels_t x_string32_kernels[] = {
+  {memcpy32_word, memcmp32_word, memset32_word, strlen32_word},              // STRING32_KERNELS_WORD
+  {memcpy32_aligned, memcmp32_aligned, memset32_aligned, strlen32_aligned},  // STRING32_KERNELS_ALIGNED
+#ifdef _STRING32_LIB_DISPATCH_WIDE
+  {memcpy64, memcmp64, memset64, strlen64},                                  // STRING32_KERNELS_WIDE
+#endif
+};
+
+// Safe kernels are used until string32_init() is called
+static const string32_kernels_t* px_string32_kernels = &x_string32_kernels[STRING32_KERNELS_ALIGNED];
+
+void string32_init(void)
+{
+  px_string32_kernels = &x_string32_kernels[string32_probe()];
+}
+#endif // _STRING32_LIB_DISPATCH_IFUNC
+
+#endif // _STRING32_LIB_DISPATCH
+
+
+// Kernel bound to public name, but without profiling wrapper
+#if defined(_STRING32_LIB_DISPATCH) && !defined(_STRING32_LIB_DISPATCH_IFUNC)
+#define _STRING32_KERNEL_CALL(x_name)  (px_string32_kernels->pf_##x_name)
+#elif defined(_STRING32_LIB_PROFILE) && !defined(_STRING32_LIB_DISPATCH)
+#define _STRING32_KERNEL_CALL(x_name)  x_name##32_word
+#else
+#define _STRING32_KERNEL_CALL(x_name)  x_name##32
+#endif
+
+#if (defined(_STRING32_LIB_DISPATCH) && !defined(_STRING32_LIB_DISPATCH_IFUNC)) \
+ || defined(_STRING32_LIB_PROFILE)
+
+void* memcpy32(void* pv_dst, void const* pv_src, size_t x_len)
+{
+  _STRING32_PROFILE_ENTER();
+  void* pv_res = _STRING32_KERNEL_CALL(memcpy)(pv_dst, pv_src, x_len);
+  _STRING32_PROFILE_LEAVE(STRING32_PROFILE_MEMCPY, pv_dst, pv_src, x_len);
+
+  return pv_res;
+}
+
+size_t memcmp32(void const* pv_ptr1, void const* pv_ptr2, size_t x_len)
+{
+  _STRING32_PROFILE_ENTER();
+  size_t x_res = _STRING32_KERNEL_CALL(memcmp)(pv_ptr1, pv_ptr2, x_len);
+  _STRING32_PROFILE_LEAVE(STRING32_PROFILE_MEMCMP, pv_ptr1, pv_ptr2, x_len);
+
+  return x_res;
+}
+
+void* memset32(void* pv_dst, uint32_t ul_val, size_t x_len)
+{
+  _STRING32_PROFILE_ENTER();
+  void* pv_res = _STRING32_KERNEL_CALL(memset)(pv_dst, ul_val, x_len);
+  _STRING32_PROFILE_LEAVE(STRING32_PROFILE_MEMSET, pv_dst, pv_dst, x_len);
+
+  return pv_res;
+}
+
+size_t strlen32(void const* pv_src)
+{
+  _STRING32_PROFILE_ENTER();
+  size_t x_res = _STRING32_KERNEL_CALL(strlen)(pv_src);
+  _STRING32_PROFILE_LEAVE(STRING32_PROFILE_STRLEN, pv_src, pv_src, x_res);
+
+  return x_res;
+}
+#endif
+
+
+/* ================= Standard names ================== */
+
+#if defined(_STRING32_LIB_REPLACE_STD)
+#define _STRING32_STD(x_name)  x_name
+#elif defined(_STRING32_LIB_WRAP_STD)
+#define _STRING32_STD(x_name)  __wrap_##x_name
+#endif
+
+#ifdef _STRING32_STD
+// Same behavior as <string.h>, only exceptions are memcmp() and strcmp(),
+// which return -1,0,+1 instead of any negative or positive value.
+// Aligned kernels are used here, because compiler emits memcpy() for packed structs
+// and strings may end right before unmapped page or end of memory region.
+
+/*
+ * @brief Compare two C strings without unaligned word access
+ * @note Words are compared only when both strings have same misalignment,
+ *       next word is read only when current one has no terminator
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+static int strcmp32_aligned(const char* pc_str1, const char* pc_str2)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if ((pc_str1 == NULL) || (pc_str2 == NULL)) {
+    return 0;
+  }
+#endif
+
+  uint8_t const* puc_str1 = (uint8_t const*) pc_str1;
+  uint8_t const* puc_str2 = (uint8_t const*) pc_str2;
+
+  while (!_STRING32_IS_ALIGNED(puc_str1) && (*puc_str1 == *puc_str2) && (*puc_str1 != '\0')) {
+    ++puc_str1;
+    ++puc_str2;
+  }
+
+  if (_STRING32_IS_ALIGNED(puc_str1) && _STRING32_IS_ALIGNED(puc_str2)) {
+    uint32_t const* pul_str1 = (uint32_t const*) puc_str1;
+    uint32_t const* pul_str2 = (uint32_t const*) puc_str2;
+
+    while ((*pul_str1 == *pul_str2)
+           && (((*pul_str1 - 0x01010101UL) & ~*pul_str1 & 0x80808080UL) == 0UL)) {
+      ++pul_str1;
+      ++pul_str2;
+    }
+
+    puc_str1 = (uint8_t const*) pul_str1;
+    puc_str2 = (uint8_t const*) pul_str2;
+  }
+
+  while ((*puc_str1 == *puc_str2) && (*puc_str1 != '\0')) {
+    ++puc_str1;
+    ++puc_str2;
+  }
+
+  if (*puc_str1 == *puc_str2) {
+    return 0;
+  }
+
+  return (*puc_str1 > *puc_str2) ? 1 : -1;
+}
+
+_STRING32_LIB_OPTIMIZE_ATTR
+void* _STRING32_STD(memcpy)(void* pv_dst, const void* pv_src, size_t x_len)
+{
+  _STRING32_PROFILE_ENTER();
+  void* pv_res = memcpy32_aligned(pv_dst, pv_src, x_len);
+  _STRING32_PROFILE_LEAVE(STRING32_PROFILE_MEMCPY, pv_dst, pv_src, x_len);
+
+  return pv_res;
+}
+
+_STRING32_LIB_OPTIMIZE_ATTR
+void* _STRING32_STD(memset)(void* pv_dst, int l_val, size_t x_len)
+{
+  _STRING32_PROFILE_ENTER();
+  void* pv_res = memset32_aligned(pv_dst, (uint8_t) l_val, x_len);
+  _STRING32_PROFILE_LEAVE(STRING32_PROFILE_MEMSET, pv_dst, pv_dst, x_len);
+
+  return pv_res;
+}
+
+_STRING32_LIB_OPTIMIZE_ATTR
+int _STRING32_STD(memcmp)(const void* pv_ptr1, const void* pv_ptr2, size_t x_len)
+{
+  _STRING32_PROFILE_ENTER();
+  int l_res = (int) memcmp32_aligned(pv_ptr1, pv_ptr2, x_len);
+  _STRING32_PROFILE_LEAVE(STRING32_PROFILE_MEMCMP, pv_ptr1, pv_ptr2, x_len);
+
+  return l_res;
+}
+
+_STRING32_LIB_OPTIMIZE_ATTR
+size_t _STRING32_STD(strlen)(const char* pc_src)
+{
+  _STRING32_PROFILE_ENTER();
+  size_t x_res = strlen32_aligned(pc_src);
+  _STRING32_PROFILE_LEAVE(STRING32_PROFILE_STRLEN, pc_src, pc_src, x_res);
+
+  return x_res;
+}
+
+_STRING32_LIB_OPTIMIZE_ATTR
+int _STRING32_STD(strcmp)(const char* pc_str1, const char* pc_str2)
+{
+  return strcmp32_aligned(pc_str1, pc_str2);
+}
+#endif // _STRING32_STD
+
+
+/* ==================== Parallel ===================== */
+
+// Workers run at the same time, so they call kernels directly:
+// profile table is not thread safe
+static void memcpy32_chunk(string32_chunk_t const* px_chunk)
+{
+  _STRING32_KERNEL_CALL(memcpy)(px_chunk->pv_dst, px_chunk->pv_src, px_chunk->x_len);
+}
+
+static void memset32_chunk(string32_chunk_t const* px_chunk)
+{
+  _STRING32_KERNEL_CALL(memset)(px_chunk->pv_dst, px_chunk->ul_val, px_chunk->x_len);
+}
+
+/*
+ * @brief Split block of memory between workers of pool and run them
+ * @note Every chunk except last one has length multiple of word,
+ *       so memset32() pattern keeps its phase. When destination is word aligned
+ *       every chunk except first one starts on cache line of destination,
+ *       otherwise up to 3 bytes before it.
+ * @retval true if job was done by pool
+ */
+static bool string32_parallel_run(string32_pool_t const* px_pool, string32_chunk_fn_t pf_work,
+                                  void* pv_dst, void const* pv_src, uint32_t ul_val, size_t x_len)
+{
+  if ((px_pool == NULL) || (x_len < px_pool->x_threshold)) {
+    return false;
+  }
+
+  uint32_t ul_count = px_pool->ul_workers;
+
+  if (ul_count > STRING32_PARALLEL_MAX_WORKERS) {
+    ul_count = STRING32_PARALLEL_MAX_WORKERS;
+  }
+
+  // Each chunk must get at least few cache lines
+  if ((x_len / (4UL * _STRING32_LIB_CACHE_LINE)) < ul_count) {
+    ul_count = (uint32_t) (x_len / (4UL * _STRING32_LIB_CACHE_LINE));
+  }
+
+  if (ul_count < 2UL) {
+    return false;
+  }
+
+  string32_chunk_t x_chunks[STRING32_PARALLEL_MAX_WORKERS];
+  uintptr_t x_dst = (uintptr_t) pv_dst;
+  size_t x_share = x_len / ul_count;
+  size_t x_begin = 0UL;
+
+  for (uint32_t ul_i = 0UL; ul_i < ul_count; ul_i++) {
+    size_t x_end = x_len;
+
+    if (ul_i != (ul_count - 1UL)) {
+      uintptr_t x_split = x_dst + x_share * (ul_i + 1UL);
+
+      x_split = (x_split + _STRING32_LIB_CACHE_LINE - 1UL) & ~(uintptr_t) (_STRING32_LIB_CACHE_LINE - 1UL);
+      x_end = (size_t) (x_split - x_dst) & ~(sizeof(uint32_t) - 1UL);
+    }
+
+    x_chunks[ul_i].pv_dst = (uint8_t*) pv_dst + x_begin;
+    x_chunks[ul_i].pv_src = (pv_src != NULL) ? ((uint8_t const*) pv_src + x_begin) : NULL;
+    x_chunks[ul_i].ul_val = ul_val;
+    x_chunks[ul_i].x_len = x_end - x_begin;
+    x_begin = x_end;
+  }
+
+  px_pool->pf_run(px_pool->pv_ctx, pf_work, &x_chunks[0], ul_count);
+
+  return true;
+}
+
+/*
+ * @brief Copy large block of memory by all workers of pool
+ * @param *px_pool - Pool of workers, or NULL to use single core
+ * @param *pv_dst - Pointer to the destination array where the content is to be copied
+ * @param *pv_src - Pointer to the source of data to be copied
+ * @param x_len - Number of bytes to copy
+ * @retval destination buffer pointer
+ */
+void* memcpy32_parallel(string32_pool_t const* px_pool, void* pv_dst, void const* pv_src, size_t x_len)
+{
+  if (!string32_parallel_run(px_pool, memcpy32_chunk, pv_dst, pv_src, 0UL, x_len)) {
+    return memcpy32(pv_dst, pv_src, x_len);
+  }
+
+  return pv_dst;
+}
+
+/*
+ * @brief Fill large block of memory by all workers of pool
+ * @param *px_pool - Pool of workers, or NULL to use single core
+ * @param *pv_dst - Pointer to the block of memory to fill
+ * @param *ul_val - Pattern to be set
+ * @param x_len - Number of bytes to be set to the Pattern
+ * @retval destination buffer pointer
+ */
+void* memset32_parallel(string32_pool_t const* px_pool, void* pv_dst, uint32_t ul_val, size_t x_len)
+{
+  // Broadcast pattern once, so every chunk use exactly the same one
+  if ((ul_val != 0UL) && (x_len > sizeof(uint32_t))) {
+    if (ul_val <= 0x000000FF) {
+      ul_val |= (ul_val << 8) | (ul_val << 16) | (ul_val << 24);
+    } else if ((ul_val & 0xFFFF0000) == 0UL) {
+      ul_val |= (ul_val << 16);
+    }
+  }
+
+  if (!string32_parallel_run(px_pool, memset32_chunk, pv_dst, NULL, ul_val, x_len)) {
+    return memset32(pv_dst, ul_val, x_len);
+  }
+
+  return pv_dst;
+}
+
+#ifdef _STRING32_LIB_PARALLEL_PTHREAD
+typedef struct {
+  pthread_mutex_t x_run_lock;  // one job at time
+  pthread_mutex_t x_lock;
+  pthread_cond_t x_start;
+  pthread_cond_t x_done;
+  string32_chunk_fn_t pf_work;
+  string32_chunk_t const* px_chunks;
+  uint32_t ul_count;
+  uint32_t ul_generation;
+  uint32_t ul_pending;
+  uint32_t ul_threads;
+  pthread_t x_threads[STRING32_PARALLEL_MAX_WORKERS - 1];
+} string32_pthread_ctx_t;
+
+typedef struct {
+  string32_pthread_ctx_t* px_ctx;
+  uint32_t ul_index;
+} string32_pthread_worker_t;
+
+// Locks are made by string32_pool_pthread_init(), rest is zero on start
+static string32_pthread_ctx_t x_string32_pthread_ctx;
+
+static string32_pthread_worker_t x_string32_pthread_workers[STRING32_PARALLEL_MAX_WORKERS - 1];
+
+static void* string32_pthread_worker(void* pv_arg)
+{
+  string32_pthread_worker_t const* px_worker = (string32_pthread_worker_t const*) pv_arg;
+  string32_pthread_ctx_t* px_ctx = px_worker->px_ctx;
+  uint32_t ul_generation = 0UL;
+
+  for (;;) {
+    pthread_mutex_lock(&px_ctx->x_lock);
+
+    while (px_ctx->ul_generation == ul_generation) {
+      pthread_cond_wait(&px_ctx->x_start, &px_ctx->x_lock);
+    }
+
+    ul_generation = px_ctx->ul_generation;
+    string32_chunk_fn_t pf_work = px_ctx->pf_work;
+    string32_chunk_t const* px_chunks = px_ctx->px_chunks;
+    uint32_t ul_count = px_ctx->ul_count;
+
+    pthread_mutex_unlock(&px_ctx->x_lock);
+
+    // Chunk 0 is done by caller
+    if (px_worker->ul_index < ul_count) {
+      pf_work(&px_chunks[px_worker->ul_index]);
+    }
+
+    pthread_mutex_lock(&px_ctx->x_lock);
+
+    if (--px_ctx->ul_pending == 0UL) {
+      pthread_cond_signal(&px_ctx->x_done);
+    }
+
+    pthread_mutex_unlock(&px_ctx->x_lock);
+  }
+
+  return NULL;
+}
+
+static void string32_pthread_run(void* pv_ctx, string32_chunk_fn_t pf_work,
+                                 string32_chunk_t const* px_chunks, uint32_t ul_count)
+{
+  string32_pthread_ctx_t* px_ctx = (string32_pthread_ctx_t*) pv_ctx;
+
+  pthread_mutex_lock(&px_ctx->x_run_lock);
+  pthread_mutex_lock(&px_ctx->x_lock);
+
+  px_ctx->pf_work = pf_work;
+  px_ctx->px_chunks = px_chunks;
+  px_ctx->ul_count = ul_count;
+  px_ctx->ul_pending = px_ctx->ul_threads;
+  ++px_ctx->ul_generation;
+  pthread_cond_broadcast(&px_ctx->x_start);
+
+  pthread_mutex_unlock(&px_ctx->x_lock);
+
+  pf_work(&px_chunks[0]);
+
+  pthread_mutex_lock(&px_ctx->x_lock);
+
+  while (px_ctx->ul_pending != 0UL) {
+    pthread_cond_wait(&px_ctx->x_done, &px_ctx->x_lock);
+  }
+
+  pthread_mutex_unlock(&px_ctx->x_lock);
+  pthread_mutex_unlock(&px_ctx->x_run_lock);
+}
+#endif // _STRING32_LIB_PARALLEL_PTHREAD
+
+/*
+ * @brief Make pool of POSIX threads
+ * @param *px_pool - Pool to initialise
+ * @param ul_workers - Number of workers including caller thread
+ * @param x_threshold - Size below which single core kernel is used
+ * @note Threads are started once and live forever, only one pool can exist
+ * @retval true if pool is ready
+ */
+bool string32_pool_pthread_init(string32_pool_t* px_pool, uint32_t ul_workers, size_t x_threshold)
+{
+#ifdef _STRING32_LIB_PARALLEL_PTHREAD
+  string32_pthread_ctx_t* px_ctx = &x_string32_pthread_ctx;
+
+  if ((px_ctx->ul_threads != 0UL) || (ul_workers < 2UL) || (ul_workers > STRING32_PARALLEL_MAX_WORKERS)) {
+    return false;
+  }
+
+  pthread_mutex_init(&px_ctx->x_run_lock, NULL);
+  pthread_mutex_init(&px_ctx->x_lock, NULL);
+  pthread_cond_init(&px_ctx->x_start, NULL);
+  pthread_cond_init(&px_ctx->x_done, NULL);
+
+  for (uint32_t ul_i = 0UL; ul_i < (ul_workers - 1UL); ul_i++) {
+    x_string32_pthread_workers[ul_i].px_ctx = px_ctx;
+    x_string32_pthread_workers[ul_i].ul_index = ul_i + 1UL;
+
+    if (pthread_create(&px_ctx->x_threads[ul_i], NULL, string32_pthread_worker,
+                       &x_string32_pthread_workers[ul_i]) != 0) {
+      break;
+    }
+
+    pthread_detach(px_ctx->x_threads[ul_i]);
+    ++px_ctx->ul_threads;
+  }
+
+  if (px_ctx->ul_threads == 0UL) {
+    return false;
+  }
+
+  px_pool->pf_run = string32_pthread_run;
+  px_pool->pv_ctx = px_ctx;
+  px_pool->ul_workers = px_ctx->ul_threads + 1UL;
+  px_pool->x_threshold = x_threshold;
+
+  return true;
+#else
+  (void) px_pool;
+  (void) ul_workers;
+  (void) x_threshold;
+
+  return false;
+#endif
+}
+
+#ifdef _STRING32_LIB_PARALLEL_RP2040
+typedef struct {
+  string32_chunk_fn_t pf_work;
+  string32_chunk_t const* px_chunk;
+} string32_rp2040_job_t;
+
+static void string32_rp2040_core1(void)
+{
+  for (;;) {
+    string32_rp2040_job_t const* px_job = (string32_rp2040_job_t const*) multicore_fifo_pop_blocking();
+
+    px_job->pf_work(px_job->px_chunk);
+    multicore_fifo_push_blocking(0UL);
+  }
+}
+
+static void string32_rp2040_run(void* pv_ctx, string32_chunk_fn_t pf_work,
+                                string32_chunk_t const* px_chunks, uint32_t ul_count)
+{
+  (void) pv_ctx;
+  (void) ul_count;
+
+  string32_rp2040_job_t x_job = {
+    .pf_work = pf_work,
+    .px_chunk = &px_chunks[1],
+  };
+
+  multicore_fifo_push_blocking((uint32_t) &x_job);
+  pf_work(&px_chunks[0]);
+  (void) multicore_fifo_pop_blocking();
+}
+#endif // _STRING32_LIB_PARALLEL_RP2040
+
+/*
+ * @brief Make pool of both RP2040 cores
+ * @param *px_pool - Pool to initialise
+ * @param x_threshold - Size below which single core kernel is used
+ * @note Launches worker on core 1, so core 1 and its FIFO can't be used for anything else.
+ *       Pool must be used only from core 0.
+ * @retval true if pool is ready
+ */
+bool string32_pool_rp2040_init(string32_pool_t* px_pool, size_t x_threshold)
+{
+#ifdef _STRING32_LIB_PARALLEL_RP2040
+  multicore_launch_core1(string32_rp2040_core1);
+
+  px_pool->pf_run = string32_rp2040_run;
+  px_pool->pv_ctx = NULL;
+  px_pool->ul_workers = 2UL;
+  px_pool->x_threshold = x_threshold;
+
+  return true;
+#else
+  (void) px_pool;
+  (void) x_threshold;
+
+  return false;
+#endif
 }
@@ -28,6 +28,7 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h> // seems strange, but hey? Where i suppose to get size_t ?
 
 /* =================== Copying ======================= */
@@ -45,11 +46,156 @@ size_t strcmp32(const char* pc_str1, const char* pc_str2);
 /* ================== Searching ====================== */
 // memchr
 // strchr
+bool memis32(void const* pv_src, uint8_t uc_val, size_t x_len);
+size_t memfirstnot32(void const* pv_src, uint8_t uc_val, size_t x_len);
+
+/* ===================== UTF-8 ======================= */
+size_t utf8len32(void const* pv_src);
+bool utf8valid32(void const* pv_src, size_t x_len);
+
+/* ===================== Codecs ====================== */
+#define STRING32_CODEC_ERROR      ((size_t) -1)
+
+#define STRING32_HEXENC_LEN(x_len)  ((x_len) * 2)
+#define STRING32_HEXDEC_LEN(x_len)  ((x_len) / 2)
+#define STRING32_B64ENC_LEN(x_len)  ((((x_len) + 2) / 3) * 4)
+#define STRING32_B64DEC_LEN(x_len)  (((x_len) / 4) * 3)
+
+size_t hexenc32(char* pc_dst, void const* pv_src, size_t x_len);
+size_t hexdec32(void* pv_dst, const char* pc_src, size_t x_len);
+size_t b64enc32(char* pc_dst, void const* pv_src, size_t x_len);
+size_t b64dec32(void* pv_dst, const char* pc_src, size_t x_len);
+
+/* ===================== Matcher ===================== */
+#define STRING32_MATCH_PREFIX  (1UL << 0)  // keyword may be followed by anything
+#define STRING32_MATCH_NOCASE  (1UL << 1)  // ignore case of ASCII letters
+#define STRING32_MATCH_WORD    (1UL << 2)  // as PREFIX, but keyword must end at word boundary
+#define STRING32_MATCH_NONE    (-1)
+
+typedef struct {
+  uint32_t ul_head;   // first 4 chars of keyword, zero padded
+  uint16_t us_index;  // index in keywords table
+  uint16_t us_len;
+} string32_match_entry_t;
+
+typedef struct {
+  const char* const* ppc_keys;
+  string32_match_entry_t* px_entries;
+  uint32_t ul_count;
+  uint32_t ul_flags;
+} string32_matcher_t;
+
+bool string32_matcher_init(string32_matcher_t* px_matcher, const char* const* ppc_keys, uint32_t ul_count,
+                           string32_match_entry_t* px_entries, uint32_t ul_flags);
+int32_t string32_match(string32_matcher_t const* px_matcher, const char* pc_input, size_t x_len);
+
+/* ===================== Hashing ===================== */
+uint32_t memhash32(void const* pv_src, size_t x_len);
+uint32_t memhash32_seed(void const* pv_src, size_t x_len, uint32_t ul_seed);
+uint32_t strhash32(void const* pv_src);
+uint32_t strhash32_seed(void const* pv_src, uint32_t ul_seed, size_t* px_len);
 
 /* ==================== Other ======================== */
 void* memset32(void* pv_dst, uint32_t ul_val, size_t x_len);
 size_t strlen32(void const* pv_src);
 
+/* ================= 64bit kernels =================== */
+// Same as *32 ones, but made for 64bit words.
+// On Cortex-M pointers of memcpy64(), memcmp64() and memset64() must be aligned to 4 bytes,
+// as LDRD/STRD can't do unaligned access. strlen64() takes any pointer.
+void* memcpy64(void* pv_dst, void const* pv_src, size_t x_len);
+size_t memcmp64(void const* pv_ptr1, void const* pv_ptr2, size_t x_len);
+void* memset64(void* pv_dst, uint32_t ul_val, size_t x_len);
+size_t strlen64(void const* pv_src);
+
+/* ==================== Startup ====================== */
+// Same layout as __copy_table_t and __zero_table_t of CMSIS startup code,
+// sizes are in words
+typedef struct {
+  uint32_t const* pul_src;
+  uint32_t* pul_dst;
+  uint32_t ul_wlen;
+} string32_copy_region_t;
+
+typedef struct {
+  uint32_t* pul_dst;
+  uint32_t ul_wlen;
+} string32_zero_region_t;
+
+void string32_init_sections(const string32_copy_region_t* px_copy_start,
+                            const string32_copy_region_t* px_copy_end,
+                            const string32_zero_region_t* px_zero_start,
+                            const string32_zero_region_t* px_zero_end);
+
+/* =================== Profiling ===================== */
+typedef enum {
+  STRING32_PROFILE_MEMCPY = 0,
+  STRING32_PROFILE_MEMCMP,
+  STRING32_PROFILE_MEMSET,
+  STRING32_PROFILE_STRLEN,
+
+  STRING32_PROFILE_TOTAL
+} string32_profile_func_t;
+
+// One bucket for zero length and one per every bit of size_t
+#define STRING32_PROFILE_SIZE_BUCKETS   (sizeof(size_t) * 8 + 1)
+#define STRING32_PROFILE_ALIGN_CLASSES  (sizeof(uint32_t))
+
+typedef struct {
+  uint32_t ul_calls;
+  uint32_t ul_size_hist[STRING32_PROFILE_SIZE_BUCKETS];
+  uint32_t ul_align_hist[STRING32_PROFILE_ALIGN_CLASSES][STRING32_PROFILE_ALIGN_CLASSES]; // [dst][src]
+  uint64_t ull_clocks;
+} string32_profile_t;
+
+// Single profiled call, passed to hook set by string32_profile_set_hook()
+typedef struct {
+  string32_profile_func_t e_func;
+  void const* pv_dst;
+  void const* pv_src;    // same as pv_dst for memset and strlen
+  size_t x_len;          // string length for strlen
+  uint32_t ul_clocks;
+} string32_profile_call_t;
+
+typedef void (*string32_profile_hook_t)(string32_profile_call_t const* px_call);
+
+const string32_profile_t* string32_profile_get(string32_profile_func_t e_func);
+void string32_profile_set_hook(string32_profile_hook_t pf_hook);
+void string32_profile_reset(void);
+void string32_profile_dump(void (*pf_putc)(char c_sym));
+
+/* ================== Dispatching ==================== */
+void string32_init(void);
+
+/* ==================== Parallel ===================== */
+#ifndef STRING32_PARALLEL_MAX_WORKERS
+#define STRING32_PARALLEL_MAX_WORKERS  8
+#endif
+
+typedef struct {
+  void* pv_dst;
+  void const* pv_src;
+  uint32_t ul_val;
+  size_t x_len;
+} string32_chunk_t;
+
+typedef void (*string32_chunk_fn_t)(string32_chunk_t const* px_chunk);
+
+typedef struct {
+  // Must call pf_work() for every chunk and return only when all of them are done
+  void (*pf_run)(void* pv_ctx, string32_chunk_fn_t pf_work,
+                 string32_chunk_t const* px_chunks, uint32_t ul_count);
+  void* pv_ctx;
+  uint32_t ul_workers;  // including caller, up to STRING32_PARALLEL_MAX_WORKERS
+  size_t x_threshold;   // below it single core kernel is used
+} string32_pool_t;
+
+void* memcpy32_parallel(string32_pool_t const* px_pool, void* pv_dst, void const* pv_src, size_t x_len);
+void* memset32_parallel(string32_pool_t const* px_pool, void* pv_dst, uint32_t ul_val, size_t x_len);
+
+bool string32_pool_pthread_init(string32_pool_t* px_pool, uint32_t ul_workers, size_t x_threshold);
+bool string32_pool_rp2040_init(string32_pool_t* px_pool, size_t x_threshold);
+
 #ifdef __cplusplus
 }
 #endif
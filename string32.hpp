@@ -0,0 +1,534 @@
+/*
+ * Description:
+ * C++ layer of string32 library.
+ *
+ * constexpr wrappers are folded at compile time for constant arguments,
+ * and use string32 kernels at runtime.
+ * With GCC and Clang literals are folded in runtime code too.
+ * std::string_view, std::span and std::array overloads pass already known
+ * lengths to kernels, so strlen32() is not needed for them.
+ * Lengths known at compile time up to detail::inline_limit are done inline,
+ * without kernel call.
+ *
+ * Use it as string32::strlen32(), etc., as plain C names
+ * are in global namespace already.
+ *
+ * Author: 
+ * Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C++17
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+#ifndef _STRING32_HPP
+#define _STRING32_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__has_include)
+#if __has_include(<span>) && (__cplusplus >= 202002L)
+#include <span>
+#endif
+#endif
+
+#include "string32.h"
+
+// constexpr wrappers can be checked by static_assert only with compiler support
+#if defined(__cpp_lib_is_constant_evaluated) || (defined(__GNUC__) && (__GNUC__ >= 9)) || defined(__clang__)
+#define _STRING32_HPP_CONSTEXPR_FOLD
+#endif
+
+// Check if value is known at compile time after inlining
+#if defined(__GNUC__) || defined(__clang__)
+#define _STRING32_HPP_IS_CONSTANT(x) __builtin_constant_p(x)
+#else
+#define _STRING32_HPP_IS_CONSTANT(x) false
+#endif
+
+// Loops of detail::*_small() run up to inline_limit / 4 times
+#if defined(__GNUC__) || defined(__clang__)
+#define _STRING32_HPP_UNROLL _Pragma("GCC unroll 8")
+#else
+#define _STRING32_HPP_UNROLL
+#endif
+
+namespace string32 {
+
+namespace detail {
+
+/*
+ * @brief Check if call is evaluated at compile time
+ * @note Without compiler support it is always false,
+ *       so only runtime kernels are used
+ */
+constexpr bool is_constant_evaluated() noexcept
+{
+#if defined(__cpp_lib_is_constant_evaluated)
+  return std::is_constant_evaluated();
+#elif (defined(__GNUC__) && (__GNUC__ >= 9)) || defined(__clang__)
+  return __builtin_is_constant_evaluated();
+#else
+  return false;
+#endif
+}
+
+constexpr int compare(std::string_view x_str1, std::string_view x_str2) noexcept
+{
+  std::size_t x_len = (x_str1.size() < x_str2.size()) ? x_str1.size() : x_str2.size();
+
+  for (std::size_t x_i = 0; x_i < x_len; x_i++) {
+    auto uc_sym1 = static_cast<unsigned char>(x_str1[x_i]);
+    auto uc_sym2 = static_cast<unsigned char>(x_str2[x_i]);
+
+    if (uc_sym1 != uc_sym2) {
+      return (uc_sym1 > uc_sym2) ? 1 : -1;
+    }
+  }
+
+  return (x_str1.size() == x_str2.size()) ? 0 : ((x_str1.size() > x_str2.size()) ? 1 : -1);
+}
+
+// Known lengths up to this are done inline, bigger ones go to kernels
+constexpr std::size_t inline_limit = 32;
+
+/*
+ * @brief Same pattern as memset32() kernel makes
+ */
+constexpr std::uint32_t pattern(std::uint32_t ul_val) noexcept
+{
+  if (ul_val <= 0x000000FF) {
+    return ul_val * 0x01010101UL;
+  }
+
+  if ((ul_val & 0xFFFF0000) == 0UL) {
+    return ul_val | (ul_val << 16);
+  }
+
+  return ul_val;
+}
+
+/*
+ * @brief Byte of pattern as it lays in memory
+ */
+constexpr unsigned char pattern_byte(std::uint32_t ul_pattern, std::size_t x_pos) noexcept
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  return static_cast<unsigned char>(ul_pattern >> (24 - ((x_pos % 4) * 8)));
+#else
+  return static_cast<unsigned char>(ul_pattern >> ((x_pos % 4) * 8));
+#endif
+}
+
+/*
+ * @brief Word load and store for any alignment,
+ *        compilers make single access of them where it is allowed
+ */
+inline std::uint32_t load32(unsigned char const* puc_src) noexcept
+{
+  std::uint32_t ul_word;
+
+  std::memcpy(&ul_word, puc_src, sizeof(ul_word));
+
+  return ul_word;
+}
+
+inline void store32(unsigned char* puc_dst, std::uint32_t ul_word) noexcept
+{
+  std::memcpy(puc_dst, &ul_word, sizeof(ul_word));
+}
+
+/*
+ * @brief Small copy, fill and compare for lengths known at compile time
+ * @note Loops are fully unrolled, as x_len is constant
+ */
+inline void copy_small(void* pv_dst, void const* pv_src, std::size_t x_len) noexcept
+{
+  auto puc_dst = static_cast<unsigned char*>(pv_dst);
+  auto puc_src = static_cast<unsigned char const*>(pv_src);
+
+  _STRING32_HPP_UNROLL
+  for (; x_len >= sizeof(std::uint32_t); x_len -= sizeof(std::uint32_t)) {
+    store32(puc_dst, load32(puc_src));
+    puc_dst += sizeof(std::uint32_t);
+    puc_src += sizeof(std::uint32_t);
+  }
+
+  _STRING32_HPP_UNROLL
+  for (; x_len != 0; --x_len) {
+    *puc_dst++ = *puc_src++;
+  }
+}
+
+inline void set_small(void* pv_dst, std::uint32_t ul_val, std::size_t x_len) noexcept
+{
+  auto puc_dst = static_cast<unsigned char*>(pv_dst);
+
+  if (x_len > sizeof(std::uint32_t)) {
+    std::uint32_t ul_pattern = pattern(ul_val);
+
+    _STRING32_HPP_UNROLL
+  for (; x_len >= sizeof(std::uint32_t); x_len -= sizeof(std::uint32_t)) {
+      store32(puc_dst, ul_pattern);
+      puc_dst += sizeof(std::uint32_t);
+    }
+  }
+
+  _STRING32_HPP_UNROLL
+  for (; x_len != 0; --x_len) {
+    *puc_dst++ = static_cast<unsigned char>(ul_val);
+  }
+}
+
+inline int compare_small(void const* pv_ptr1, void const* pv_ptr2, std::size_t x_len) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+  // Constant data, like literals, is compared at compile time
+  if (__builtin_constant_p(__builtin_memcmp(pv_ptr1, pv_ptr2, x_len))) {
+    int l_res = __builtin_memcmp(pv_ptr1, pv_ptr2, x_len);
+
+    return (l_res > 0) - (l_res < 0);
+  }
+#endif
+
+  auto puc_ptr1 = static_cast<unsigned char const*>(pv_ptr1);
+  auto puc_ptr2 = static_cast<unsigned char const*>(pv_ptr2);
+
+  // Mismatched word is left for bytes loop, same as kernel does
+  _STRING32_HPP_UNROLL
+  for (; x_len >= sizeof(std::uint32_t); x_len -= sizeof(std::uint32_t)) {
+    if (load32(puc_ptr1) != load32(puc_ptr2)) {
+      break;
+    }
+
+    puc_ptr1 += sizeof(std::uint32_t);
+    puc_ptr2 += sizeof(std::uint32_t);
+  }
+
+  _STRING32_HPP_UNROLL
+  for (; x_len != 0; --x_len) {
+    if (*puc_ptr1 != *puc_ptr2) {
+      return (*puc_ptr1 > *puc_ptr2) ? 1 : -1;
+    }
+
+    ++puc_ptr1;
+    ++puc_ptr2;
+  }
+
+  return 0;
+}
+
+} // namespace detail
+
+/* =================== Copying ======================= */
+
+/*
+ * @brief Copies string_view as C string
+ * @retval pointer to destination string
+ */
+inline char* strcpy32(char* pc_dst, std::string_view x_src) noexcept
+{
+  ::memcpy32(pc_dst, x_src.data(), x_src.size());
+  pc_dst[x_src.size()] = '\0';
+
+  return pc_dst;
+}
+
+/*
+ * @brief Copy block of memory
+ * @note Small lengths known at compile time are copied inline
+ * @retval destination buffer pointer
+ */
+inline void* memcpy32(void* pv_dst, void const* pv_src, std::size_t x_len) noexcept
+{
+  if (_STRING32_HPP_IS_CONSTANT(x_len) && (x_len <= detail::inline_limit)) {
+    detail::copy_small(pv_dst, pv_src, x_len);
+    return pv_dst;
+  }
+
+  return ::memcpy32(pv_dst, pv_src, x_len);
+}
+
+constexpr char* memcpy32(char* pc_dst, const char* pc_src, std::size_t x_len) noexcept
+{
+  if (detail::is_constant_evaluated()) {
+    for (std::size_t x_i = 0; x_i < x_len; x_i++) {
+      pc_dst[x_i] = pc_src[x_i];
+    }
+
+    return pc_dst;
+  }
+
+  return static_cast<char*>(memcpy32(static_cast<void*>(pc_dst), static_cast<void const*>(pc_src), x_len));
+}
+
+/*
+ * @brief Copy whole std::array, size is known at compile time
+ * @note Arrays up to detail::inline_limit bytes are copied inline
+ */
+template <typename T, std::size_t N>
+inline std::array<T, N>& memcpy32(std::array<T, N>& x_dst, const std::array<T, N>& x_src) noexcept
+{
+  static_assert(std::is_trivially_copyable_v<T>, "memcpy32 needs trivially copyable type");
+
+  constexpr std::size_t x_size = sizeof(T) * N;
+
+  if constexpr (x_size <= detail::inline_limit) {
+    detail::copy_small(x_dst.data(), x_src.data(), x_size);
+  } else {
+    ::memcpy32(x_dst.data(), x_src.data(), x_size);
+  }
+
+  return x_dst;
+}
+
+#if defined(__cpp_lib_span)
+/*
+ * @brief Copy span to span, length is the smaller of them
+ * @retval number of bytes copied
+ */
+inline std::size_t memcpy32(std::span<std::byte> x_dst, std::span<const std::byte> x_src) noexcept
+{
+  std::size_t x_len = (x_dst.size() < x_src.size()) ? x_dst.size() : x_src.size();
+
+  ::memcpy32(x_dst.data(), x_src.data(), x_len);
+
+  return x_len;
+}
+#endif // __cpp_lib_span
+
+/* ================== Comparison ===================== */
+
+/*
+ * @brief Compare strings with known length
+ * @note No strlen32() is called, shorter string is less if it is prefix of longer one
+ * @retval -1,0,+1 according to original strcmp
+ */
+constexpr int strcmp32(std::string_view x_str1, std::string_view x_str2) noexcept
+{
+  if (detail::is_constant_evaluated()) {
+    return detail::compare(x_str1, x_str2);
+  }
+
+  std::size_t x_len = (x_str1.size() < x_str2.size()) ? x_str1.size() : x_str2.size();
+  int l_res = 0;
+
+  // Literals have constant length, then compare is unrolled and folded
+  if (_STRING32_HPP_IS_CONSTANT(x_len) && (x_len <= detail::inline_limit)) {
+    l_res = detail::compare_small(x_str1.data(), x_str2.data(), x_len);
+  } else {
+    l_res = static_cast<int>(::memcmp32(x_str1.data(), x_str2.data(), x_len));
+  }
+
+  if (l_res != 0) {
+    return l_res;
+  }
+
+  return (x_str1.size() == x_str2.size()) ? 0 : ((x_str1.size() > x_str2.size()) ? 1 : -1);
+}
+
+/*
+ * @brief Compare blocks of memory
+ * @note Small lengths known at compile time are compared inline
+ * @retval -1,0,+1 according to original memcmp
+ */
+inline int memcmp32(void const* pv_ptr1, void const* pv_ptr2, std::size_t x_len) noexcept
+{
+  if (_STRING32_HPP_IS_CONSTANT(x_len) && (x_len <= detail::inline_limit)) {
+    return detail::compare_small(pv_ptr1, pv_ptr2, x_len);
+  }
+
+  return static_cast<int>(::memcmp32(pv_ptr1, pv_ptr2, x_len));
+}
+
+constexpr int memcmp32(const char* pc_ptr1, const char* pc_ptr2, std::size_t x_len) noexcept
+{
+  if (detail::is_constant_evaluated()) {
+    return detail::compare(std::string_view(pc_ptr1, x_len), std::string_view(pc_ptr2, x_len));
+  }
+
+  return memcmp32(static_cast<void const*>(pc_ptr1), static_cast<void const*>(pc_ptr2), x_len);
+}
+
+/*
+ * @brief Compare whole std::arrays, size is known at compile time
+ * @note Arrays up to detail::inline_limit bytes are compared inline
+ * @retval -1,0,+1 according to original memcmp
+ */
+template <typename T, std::size_t N>
+inline int memcmp32(const std::array<T, N>& x_ptr1, const std::array<T, N>& x_ptr2) noexcept
+{
+  constexpr std::size_t x_size = sizeof(T) * N;
+
+  if constexpr (x_size <= detail::inline_limit) {
+    return detail::compare_small(x_ptr1.data(), x_ptr2.data(), x_size);
+  } else {
+    return static_cast<int>(::memcmp32(x_ptr1.data(), x_ptr2.data(), x_size));
+  }
+}
+
+/* ================== Searching ====================== */
+
+/*
+ * @brief Check that whole std::array is filled with one byte value
+ * @note Arrays up to detail::inline_limit bytes are checked inline
+ */
+template <typename T, std::size_t N>
+inline bool memis32(const std::array<T, N>& x_src, std::uint8_t uc_val) noexcept
+{
+  constexpr std::size_t x_size = sizeof(T) * N;
+
+  if constexpr (x_size <= detail::inline_limit) {
+    std::array<unsigned char, x_size> x_ref{};
+
+    detail::set_small(x_ref.data(), uc_val, x_size);
+
+    return detail::compare_small(x_src.data(), x_ref.data(), x_size) == 0;
+  } else {
+    return ::memis32(x_src.data(), uc_val, x_size);
+  }
+}
+
+#if defined(__cpp_lib_span)
+inline bool memis32(std::span<const std::byte> x_src, std::uint8_t uc_val) noexcept
+{
+  return ::memis32(x_src.data(), uc_val, x_src.size());
+}
+#endif // __cpp_lib_span
+
+/* ===================== UTF-8 ======================= */
+
+inline bool utf8valid32(std::string_view x_src) noexcept
+{
+  return ::utf8valid32(x_src.data(), x_src.size());
+}
+
+/* ==================== Other ======================== */
+
+/*
+ * @brief Fill block of memory, pattern is the same as memset32() kernel uses
+ * @note Small lengths known at compile time are filled inline
+ * @retval destination buffer pointer
+ */
+inline void* memset32(void* pv_dst, std::uint32_t ul_val, std::size_t x_len) noexcept
+{
+  if (_STRING32_HPP_IS_CONSTANT(x_len) && (x_len <= detail::inline_limit)) {
+    detail::set_small(pv_dst, ul_val, x_len);
+    return pv_dst;
+  }
+
+  return ::memset32(pv_dst, ul_val, x_len);
+}
+
+constexpr char* memset32(char* pc_dst, std::uint32_t ul_val, std::size_t x_len) noexcept
+{
+  if (detail::is_constant_evaluated()) {
+    std::uint32_t ul_pattern = (x_len > sizeof(std::uint32_t)) ? detail::pattern(ul_val) : ul_val;
+    std::size_t x_words = (x_len > sizeof(std::uint32_t)) ? (x_len & ~(sizeof(std::uint32_t) - 1)) : 0;
+
+    for (std::size_t x_i = 0; x_i < x_len; x_i++) {
+      pc_dst[x_i] = static_cast<char>((x_i < x_words) ? detail::pattern_byte(ul_pattern, x_i)
+                                                      : static_cast<unsigned char>(ul_val));
+    }
+
+    return pc_dst;
+  }
+
+  return static_cast<char*>(memset32(static_cast<void*>(pc_dst), ul_val, x_len));
+}
+
+/*
+ * @brief Fill whole std::array, size is known at compile time
+ * @note Arrays up to detail::inline_limit bytes are filled inline
+ */
+template <typename T, std::size_t N>
+inline std::array<T, N>& memset32(std::array<T, N>& x_dst, std::uint32_t ul_val) noexcept
+{
+  constexpr std::size_t x_size = sizeof(T) * N;
+
+  if constexpr (x_size <= detail::inline_limit) {
+    detail::set_small(x_dst.data(), ul_val, x_size);
+  } else {
+    ::memset32(x_dst.data(), ul_val, x_size);
+  }
+
+  return x_dst;
+}
+
+/*
+ * @brief Get string length
+ * @note Folded at compile time for literals and other constant strings,
+ *       in runtime code too with GCC and Clang
+ */
+constexpr std::size_t strlen32(const char* pc_src) noexcept
+{
+  if (detail::is_constant_evaluated()) {
+    std::size_t x_len = 0;
+
+    while (pc_src[x_len] != '\0') {
+      ++x_len;
+    }
+
+    return x_len;
+  }
+
+#if defined(__GNUC__) || defined(__clang__)
+  if (__builtin_constant_p(__builtin_strlen(pc_src))) {
+    return __builtin_strlen(pc_src);
+  }
+#endif
+
+  return ::strlen32(pc_src);
+}
+
+/* ================== Self checks ==================== */
+#ifdef _STRING32_HPP_CONSTEXPR_FOLD
+namespace detail {
+
+constexpr bool check_copy() noexcept
+{
+  char c_buf[8] = {};
+
+  memcpy32(c_buf, "string", 7);
+
+  return strcmp32(c_buf, "string") == 0;
+}
+
+constexpr bool check_set() noexcept
+{
+  char c_buf[9] = {};
+
+  memset32(c_buf, 0x41, 8);
+
+  return (strlen32(c_buf) == 8) && (memcmp32(c_buf, "AAAAAAAA", 8) == 0);
+}
+
+static_assert(strlen32("string32") == 8, "strlen32 is not folded");
+static_assert(strlen32("") == 0, "strlen32 is not folded");
+static_assert(strcmp32("abc", "abc") == 0, "strcmp32 is not folded");
+static_assert(strcmp32("abc", "abd") < 0, "strcmp32 is not folded");
+static_assert(strcmp32("abcd", "abc") > 0, "strcmp32 is not folded");
+static_assert(memcmp32("\xFF", "\x01", 1) > 0, "memcmp32 must compare unsigned bytes");
+static_assert(check_copy(), "memcpy32 is not folded");
+static_assert(check_set(), "memset32 is not folded");
+
+} // namespace detail
+#endif // _STRING32_HPP_CONSTEXPR_FOLD
+
+} // namespace string32
+
+#undef _STRING32_HPP_IS_CONSTANT
+#undef _STRING32_HPP_UNROLL
+
+#endif /* _STRING32_HPP */
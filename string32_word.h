@@ -0,0 +1,286 @@
+/*
+ * Description:
+ * Word kernels of string32 library.
+ *
+ * This file is a template: string32.c include it once per
+ * machine word width, so 32bit and 64bit kernels are made from the same source.
+ * Before including define:
+ *  _STRING32_WORD_T            - machine word type;
+ *  _STRING32_WORD_NAME(x_name) - name of kernel for this word width;
+ *  _STRING32_WORD_LINKAGE      - linkage of kernels;
+ *  _STRING32_WORD_CTZ(x_word)  - count trailing zero bits (GCC only);
+ *  _STRING32_WORD_CLZ(x_word)  - count leading zero bits (GCC only).
+ * All of them are undefined at the end of this file.
+ *
+ * Author: 
+ * Alexandr Antonov (@Bismuth208)
+ *
+ * Format:
+ *  1 Tab == 2 spaces
+ *  UTF-8
+ *  EOL - Unix
+ *
+ * Lang: C
+ * Prefered Compiler: GCC
+ *
+ * Licence: MIT
+ */
+
+// There is no include guard, as this file is included more than once
+
+// Broadcast constants for this word width
+#define _STRING32_WORD_ONES   ((_STRING32_WORD_T) (~(_STRING32_WORD_T) 0 / 0xFFU))
+#define _STRING32_WORD_HIGHS  ((_STRING32_WORD_T) (_STRING32_WORD_ONES << 7))
+#define _STRING32_WORD_REP32  ((_STRING32_WORD_T) (~(_STRING32_WORD_T) 0 / 0xFFFFFFFFUL))
+
+// Not zero if any byte of word is zero
+#define _STRING32_WORD_HAS_ZERO(x_word) \
+  (((x_word) - _STRING32_WORD_ONES) & ~(x_word) & _STRING32_WORD_HIGHS)
+
+
+/*
+ * @brief Find position of the first zero byte in word
+ * @param w_word - Word which have at least one zero byte
+ * @retval offset of zero byte in memory order
+ */
+static inline size_t _STRING32_WORD_NAME(zero_byte)(_STRING32_WORD_T w_word)
+{
+#if defined(__GNUC__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+  // Lowest marked byte is always a real zero
+  return (size_t) _STRING32_WORD_CTZ(_STRING32_WORD_HAS_ZERO(w_word)) / 8U;
+#elif defined(__GNUC__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  // Borrow may mark 0x01 bytes too, so exact mask is needed for CLZ
+  _STRING32_WORD_T w_mask = ~(((w_word & ~_STRING32_WORD_HIGHS) + ~_STRING32_WORD_HIGHS)
+                              | w_word | ~_STRING32_WORD_HIGHS);
+
+  return (size_t) _STRING32_WORD_CLZ(w_mask) / 8U;
+#else
+  uint8_t const* puc_word = (uint8_t const*) &w_word;
+  size_t x_offset = 0UL;
+
+  while (puc_word[x_offset] != 0U) {
+    ++x_offset;
+  }
+
+  return x_offset;
+#endif
+}
+
+/*
+ * @brief Copy block of memory
+ * @param *pv_dst - Pointer to the destination array where the content is to be copied
+ * @param *pv_src - Pointer to the source of data to be copied
+ * @param x_len - Number of bytes to copy
+ * @retval destination buffer pointer
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+_STRING32_WORD_LINKAGE
+void* _STRING32_WORD_NAME(memcpy)(void* pv_dst, void const* pv_src, size_t x_len)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if ((pv_dst == NULL) || (pv_src == NULL)) {
+    return NULL;
+  }
+#endif
+
+  _STRING32_WORD_T* pw_dst = (_STRING32_WORD_T*) pv_dst;
+  _STRING32_WORD_T const* pw_src = (_STRING32_WORD_T const*) pv_src;
+
+  while (x_len >= sizeof(_STRING32_WORD_T)) {
+    *pw_dst = *pw_src;
+
+    ++pw_dst;
+    ++pw_src;
+    x_len -= sizeof(_STRING32_WORD_T);
+  }
+
+  uint32_t* pul_dst = (uint32_t*) pw_dst;
+  uint32_t const* pul_src = (uint32_t const*) pw_src;
+
+  // Wide words may leave one more 32bit word
+  if ((sizeof(_STRING32_WORD_T) > sizeof(uint32_t)) && (x_len >= sizeof(uint32_t))) {
+    *pul_dst = *pul_src;
+
+    ++pul_dst;
+    ++pul_src;
+    x_len -= sizeof(uint32_t);
+  }
+
+  uint8_t* puc_dst = (uint8_t*) pul_dst;
+  uint8_t const* puc_src = (uint8_t const*) pul_src;
+
+  while (x_len--) {
+    *puc_dst = *puc_src;
+
+    ++puc_dst;
+    ++puc_src;
+  }
+
+  return pv_dst;
+}
+
+/*
+ * @brief Compare two blocks of memory 
+ * @param *pv_ptr1 - Pointer to block of memory
+ * @param *pv_ptr2 - Pointer to block of memory
+ * @param x_len - Number of bytes to compare
+ * @retval -1,0,+1 according to original memcmp
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+_STRING32_WORD_LINKAGE
+size_t _STRING32_WORD_NAME(memcmp)(void const* pv_ptr1, void const* pv_ptr2, size_t x_len)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if ((pv_ptr1 == NULL) || (pv_ptr2 == NULL)) {
+    return 0UL;
+  }
+#endif
+
+  _STRING32_WORD_T const *pw_ptr1 = (_STRING32_WORD_T const *) pv_ptr1;
+  _STRING32_WORD_T const *pw_ptr2 = (_STRING32_WORD_T const *) pv_ptr2;
+
+  size_t x_res = 0L;
+
+  if (pw_ptr1 == pw_ptr2) {
+    goto MEMCMP_DONE_END;
+  } else {
+    while (x_len >= sizeof(_STRING32_WORD_T)) {
+      if (*pw_ptr1 != *pw_ptr2) {
+        // Words can't be compared as numbers on little-endian,
+        // so mismatched word is left for bytes loop
+        break;
+      }
+
+      ++pw_ptr1;
+      ++pw_ptr2;
+      x_len -= sizeof(_STRING32_WORD_T);
+    }
+
+    uint8_t const *puc_ptr1 = (uint8_t const *) pw_ptr1;
+    uint8_t const *puc_ptr2 = (uint8_t const *) pw_ptr2;
+
+    while (x_len--) {
+      if (*puc_ptr1 != *puc_ptr2) {
+        x_res = (*puc_ptr1 > *puc_ptr2) ? 1 : -1;
+        goto MEMCMP_DONE_END;
+      }
+
+      ++puc_ptr1;
+      ++puc_ptr2;
+    }
+  }
+
+  MEMCMP_DONE_END:
+  return x_res;
+}
+
+/*
+ * @brief Fill block of memory
+ * @param *pv_dst - Pointer to the block of memory to fill
+ * @param *ul_val - Pattern to be set
+ * @param x_len - Number of bytes to be set to the Pattern
+ * @note Pattern is placed the same way for every word width
+ * @retval destination buffer pointer
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+_STRING32_WORD_LINKAGE
+void* _STRING32_WORD_NAME(memset)(void* pv_dst, uint32_t ul_val, size_t x_len)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if (pv_dst == NULL) {
+    return NULL;
+  }
+#endif
+
+  uint32_t* pul_dst = (uint32_t*) pv_dst;
+
+  if (x_len > sizeof(uint32_t)) {
+    if (ul_val != 0) {
+      if (ul_val <= 0x000000FF) {
+        ul_val |= (ul_val << 8) | (ul_val << 16) | (ul_val << 24);
+      } else if ((ul_val & 0xFFFF0000) == 0UL) {
+        ul_val |= (ul_val << 16);
+      }
+    }
+
+    _STRING32_WORD_T w_val = (_STRING32_WORD_T) ul_val * _STRING32_WORD_REP32;
+    _STRING32_WORD_T* pw_dst = (_STRING32_WORD_T*) pv_dst;
+
+    while (x_len >= sizeof(_STRING32_WORD_T)) {
+      *pw_dst = w_val;
+      ++pw_dst;
+      x_len -= sizeof(_STRING32_WORD_T);
+    }
+
+    pul_dst = (uint32_t*) pw_dst;
+
+    // Wide words may leave one more 32bit word
+    if ((sizeof(_STRING32_WORD_T) > sizeof(uint32_t)) && (x_len >= sizeof(uint32_t))) {
+      *pul_dst = ul_val;
+      ++pul_dst;
+      x_len -= sizeof(uint32_t);
+    }
+  }
+
+  uint8_t* puc_dst = (uint8_t*) pul_dst;
+
+  while (x_len--) {
+    *puc_dst = (uint8_t) ul_val;
+    ++puc_dst;
+  }
+
+  return pv_dst;
+}
+
+/*
+ * @brief Get string length
+ * @param *pv_src - C string
+ * @retval the length of string
+ */
+_STRING32_LIB_OPTIMIZE_ATTR
+_STRING32_WORD_LINKAGE
+size_t _STRING32_WORD_NAME(strlen)(void const* pv_src)
+{
+#ifdef _STRING32_LIB_OPTIMIZE_NULL_CHECK
+  if (pv_src == NULL) {
+    return 0UL;
+  }
+#endif
+
+  uint8_t const* puc_src = (uint8_t const*) pv_src;
+
+  // Words are read only from aligned addresses, so aligned word which hold
+  // terminator is never crossing page or memory region boundary
+  while (((uintptr_t) puc_src & (sizeof(_STRING32_WORD_T) - 1U)) != 0U) {
+    if (*puc_src == '\0') {
+      return (size_t)(puc_src - (uint8_t const*) pv_src);
+    }
+
+    ++puc_src;
+  }
+
+  _STRING32_WORD_T const *pw_src = (_STRING32_WORD_T const*) puc_src;
+  _STRING32_WORD_T w_word_chunk = *pw_src;
+
+  // Idea based on concept when we trying to
+  // discover '\0' at end of the sting splitted to word chunks,
+  // all bytes of chunk are tested at once
+  while (_STRING32_WORD_HAS_ZERO(w_word_chunk) == 0) {
+    ++pw_src;
+    w_word_chunk = *pw_src;
+  }
+
+  return (size_t)((const uint8_t *) pw_src - (const uint8_t *) pv_src)
+         + _STRING32_WORD_NAME(zero_byte)(w_word_chunk);
+}
+
+#undef _STRING32_WORD_HAS_ZERO
+#undef _STRING32_WORD_REP32
+#undef _STRING32_WORD_HIGHS
+#undef _STRING32_WORD_ONES
+
+#undef _STRING32_WORD_CLZ
+#undef _STRING32_WORD_CTZ
+#undef _STRING32_WORD_LINKAGE
+#undef _STRING32_WORD_NAME
+#undef _STRING32_WORD_T